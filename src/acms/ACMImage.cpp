@@ -0,0 +1,548 @@
+/**
+ * \file		acms/ACMImage.cpp
+ * \brief		The methods of the <b>ACMImage</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "ACMImage.h"
+#include "EventIndex.h"
+#include "Penknife.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "assert.h"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Maps a binary ACM file.
+ * 
+ * \fn		ACMImage::ACMImage(const char *file)
+ * \param	*file: the name of the file.
+ * 
+ * Only the header and the sizes of the arrays are checked, so the time does
+ * not depend on the size of the graph. The program stops if the file can
+ * not be mapped or is not a binary ACM.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+ACMImage::ACMImage(const char *file)
+{
+	struct stat st;
+	int fd = open(file, O_RDONLY);
+	
+	Map = MAP_FAILED;
+	
+	if (fd != -1 && fstat(fd, &st) == 0 && st.st_size > 0) {
+		
+		bytes = st.st_size;
+		Map = mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	
+	if (fd != -1) {
+		
+		close(fd);
+	}
+	
+	if (Map == MAP_FAILED) {
+		
+		Penknife::pkerrors(_IMAGE_ERROR_OPEN, (char *) file);
+		exit(_IMAGE_ERROR_CODE_OPEN);
+	}
+	
+	Header = (const ImageHeader *) Map;
+	
+	bool valid = bytes >= sizeof(ImageHeader) && \
+		Header->magic == _IMAGE_MAGIC && Header->version == _IMAGE_VERSION && \
+		Header->states > 0 && Header->arcs >= 0 && Header->events >= 0 && \
+		Header->processes >= 0 && Header->strings > 0;
+	
+	if (valid) {
+		
+		size_t ints = (size_t) Header->states + 1 + 6 * (size_t) Header->arcs \
+			+ 3 * (size_t) Header->events + Header->processes;
+		
+		valid = (bytes >= sizeof(ImageHeader) + ints * sizeof(int) + \
+			Header->strings);
+	}
+	
+	if (valid) {
+		
+		First = (const int *) (Header + 1);
+		ArcDest = First + Header->states + 1;
+		ArcEvent = ArcDest + Header->arcs;
+		ArcIO = ArcEvent + Header->arcs;
+		ArcChannel = ArcIO + Header->arcs;
+		ArcCell = ArcChannel + Header->arcs;
+		ArcSlot = ArcCell + Header->arcs;
+		EventClass = ArcSlot + Header->arcs;
+		EventProcess = EventClass + Header->events;
+		EventName = EventProcess + Header->events;
+		ProcessName = EventName + Header->events;
+		Strings = (const char *) (ProcessName + Header->processes);
+		
+		valid = First[0] == 0 && First[Header->states] == Header->arcs && \
+			Header->init >= 0 && Header->init < Header->states && \
+			Header->label >= 0 && Header->label < Header->strings && \
+			Strings[Header->strings - 1] == '\0';
+	}
+	
+	if (valid == false) {
+		
+		munmap(Map, bytes);
+		
+		Penknife::pkerrors(_IMAGE_ERROR_FORMAT, (char *) file);
+		exit(_IMAGE_ERROR_CODE_FORMAT);
+	}
+}
+
+/**
+ * \brief	Class destructor. Unmaps the file.
+ * 
+ * \fn		ACMImage::~ACMImage()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+ACMImage::~ACMImage()
+{
+	munmap(Map, bytes);
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Gets the label of the model.
+ * 
+ * \fn		const char * ACMImage::getLabel()
+ * \return	The label.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const char * ACMImage::getLabel()
+{
+	return Strings + Header->label;
+}
+
+/**
+ * \brief	Gets the number of states.
+ * 
+ * \fn		int ACMImage::getStates()
+ * \return	The number of states.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getStates()
+{
+	return Header->states;
+}
+
+/**
+ * \brief	Gets the number of arcs.
+ * 
+ * \fn		int ACMImage::getArcs()
+ * \return	The number of arcs.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getArcs()
+{
+	return Header->arcs;
+}
+
+/**
+ * \brief	Gets the number of events.
+ * 
+ * \fn		int ACMImage::getEvents()
+ * \return	The number of events.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getEvents()
+{
+	return Header->events;
+}
+
+/**
+ * \brief	Gets the number of processes of the system.
+ * 
+ * \fn		int ACMImage::getProcesses()
+ * \return	The number of processes.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getProcesses()
+{
+	return Header->processes;
+}
+
+/**
+ * \brief	Gets the initial state.
+ * 
+ * \fn		int ACMImage::getInit()
+ * \return	The initial state.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getInit()
+{
+	return Header->init;
+}
+
+/**
+ * \brief	Gets the first arc leaving a state.
+ * 
+ * \fn		int ACMImage::getFirstArc(int state)
+ * \param	state: the state.
+ * \return	The first arc leaving <i>state</i>. The arcs leaving it go up to
+ * 			<code>getLastArc()</code> (excluded).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getFirstArc(int state)
+{
+	assert(state >= 0 && state < Header->states);
+	
+	return First[state];
+}
+
+/**
+ * \brief	Gets the arc after the last one leaving a state.
+ * 
+ * \fn		int ACMImage::getLastArc(int state)
+ * \param	state: the state.
+ * \return	The first arc leaving the next state.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getLastArc(int state)
+{
+	assert(state >= 0 && state < Header->states);
+	
+	return First[state + 1];
+}
+
+/**
+ * \brief	Gets the destination of an arc.
+ * 
+ * \fn		int ACMImage::getDest(int arc)
+ * \param	arc: the arc.
+ * \return	The destination state.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getDest(int arc)
+{
+	return ArcDest[arc];
+}
+
+/**
+ * \brief	Gets the event of an arc.
+ * 
+ * \fn		int ACMImage::getEvent(int arc)
+ * \param	arc: the arc.
+ * \return	The event (see <code>getEventLabel()</code>).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getEvent(int arc)
+{
+	return ArcEvent[arc];
+}
+
+/**
+ * \brief	Gets the IO type of an arc.
+ * 
+ * \fn		int ACMImage::getIOType(int arc)
+ * \param	arc: the arc.
+ * \return	<code>_ARC_WRITE</code>, <code>_ARC_READ</code>,
+ * 			<code>_ARC_CONTROL</code> or <code>_ARC_NONE</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getIOType(int arc)
+{
+	return ArcIO[arc];
+}
+
+/**
+ * \brief	Gets the channel of an arc.
+ * 
+ * \fn		int ACMImage::getChannel(int arc)
+ * \param	arc: the arc.
+ * \return	The channel, or <code>_ARC_NONE</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getChannel(int arc)
+{
+	return ArcChannel[arc];
+}
+
+/**
+ * \brief	Gets the cell of the IO operation of an arc.
+ * 
+ * \fn		int ACMImage::getOnCell(int arc)
+ * \param	arc: the arc.
+ * \return	The cell, or <code>_ARC_NONE</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getOnCell(int arc)
+{
+	return ArcCell[arc];
+}
+
+/**
+ * \brief	Gets the slot of the IO operation of an arc.
+ * 
+ * \fn		int ACMImage::getOnSlot(int arc)
+ * \param	arc: the arc.
+ * \return	The slot, or <code>_ARC_NONE</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getOnSlot(int arc)
+{
+	return ArcSlot[arc];
+}
+
+/**
+ * \brief	Gets the label of an event.
+ * 
+ * \fn		const char * ACMImage::getEventLabel(int event)
+ * \param	event: the event.
+ * \return	The label.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const char * ACMImage::getEventLabel(int event)
+{
+	return Strings + EventName[event];
+}
+
+/**
+ * \brief	Gets the class of an event.
+ * 
+ * \fn		int ACMImage::getEventClass(int event)
+ * \param	event: the event.
+ * \return	<code>_EVENTS_INTERNAL</code>, <code>_EVENTS_OUTPUTS</code> or
+ * 			<code>_EVENTS_DUMMY</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getEventClass(int event)
+{
+	return EventClass[event];
+}
+
+/**
+ * \brief	Gets the process of an event.
+ * 
+ * \fn		int ACMImage::getEventProcess(int event)
+ * \param	event: the event.
+ * \return	The process, or <code>_ARC_NONE</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int ACMImage::getEventProcess(int event)
+{
+	return EventProcess[event];
+}
+
+/**
+ * \brief	Gets the label of a process of the system.
+ * 
+ * \fn		const char * ACMImage::getProcessLabel(int proc)
+ * \param	proc: the process.
+ * \return	The label.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const char * ACMImage::getProcessLabel(int proc)
+{
+	return Strings + ProcessName[proc];
+}
+
+/**
+ * \brief	Gets the bytes saved after the <code>ACM</code>.
+ * 
+ * \fn		string ACMImage::getTrailer()
+ * \return	The bytes from the end of the strings to the end of the file.
+ * 			Empty if there are none.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+string ACMImage::getTrailer()
+{
+	const char *end = Strings + Header->strings;
+	
+	return string(end, (const char *) Map + bytes - end);
+}
+
+/**
+ * \brief	Builds a <b>Process</b> with the graph.
+ * 
+ * \fn		Process * ACMImage::toProcess()
+ * \return	A new process, with the same states and arcs (and the same IO
+ * 			information) of the <code>ACM</code> that was saved. Unlike the
+ * 			image, it is a copy in memory, as large as the graph.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+Process * ACMImage::toProcess()
+{
+	int cont, arc;
+	Process *p = new Process(getLabel());
+	
+	for (cont = 0; cont < Header->states; cont++) {
+		
+		p->insertState();
+	}
+	
+	for (cont = 0; cont < Header->states; cont++) {
+		
+		for (arc = First[cont]; arc < First[cont + 1]; arc++) {
+			
+			const char *lab = getEventLabel(ArcEvent[arc]);
+			
+			if (ArcIO[arc] == _ARC_NONE) {
+				
+				p->insertArc(cont, lab, ArcDest[arc]);
+			} else {
+				
+				p->insertArc(cont, lab, ArcDest[arc], ArcIO[arc], \
+					ArcChannel[arc]);
+				p->Arcs.back()->setOnCell(ArcCell[arc]);
+				p->Arcs.back()->setOnSlot(ArcSlot[arc]);
+			}
+		}
+	}
+	
+	return p;
+}
+
+/**
+ * \brief	Writes the graph in the Petrify format.
+ * 
+ * \fn		void ACMImage::petrify(ostream &out)
+ * \param	out: where it is written.
+ * 
+ * Writes the same lines that <code>StateGraph::acm2petrify()</code> wrote
+ * for the <code>ACM</code>, but the comments.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void ACMImage::petrify(ostream &out)
+{
+	const char *heads[] = {".internal", ".outputs", ".dummy"};
+	int cont, c2;
+	
+	out << ".model " << getLabel() << endl;
+	
+	for (cont = _EVENTS_INTERNAL; cont <= _EVENTS_DUMMY; cont++) {
+		
+		bool empty = true;
+		
+		for (c2 = 0; c2 < Header->events; c2++) {
+			
+			if (EventClass[c2] != cont) {
+				
+				continue;
+			}
+			
+			if (empty) {
+				
+				out << heads[cont];
+				empty = false;
+			}
+			
+			out << " " << getEventLabel(c2);
+		}
+		
+		if (empty == false) {
+			
+			out << endl;
+		}
+	}
+	
+	for (cont = 0; cont < Header->processes; cont++) {
+		
+		out << ".process " << cont;
+		
+		for (c2 = 0; c2 < Header->events; c2++) {
+			
+			if (EventProcess[c2] == cont) {
+				
+				out << " " << getEventLabel(c2);
+			}
+		}
+		
+		out << endl;
+	}
+	
+	out << ".state graph" << " # begin state graph" << endl;
+	
+	for (cont = 0; cont < Header->states; cont++) {
+		
+		for (c2 = First[cont]; c2 < First[cont + 1]; c2++) {
+			
+			out << "s" << cont << " " << getEventLabel(ArcEvent[c2]) << " s" \
+				<< ArcDest[c2] << "\n";
+		}
+	}
+	
+	out << ".marking{s" << Header->init << "}" << endl;
+	out << ".end" << " # end state graph" << endl;
+}
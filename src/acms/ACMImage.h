@@ -0,0 +1,204 @@
+/**
+ * \file		acms/ACMImage.h
+ * \brief		The definition of the <b>ACMImage</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include "Process.h"
+
+#include <iostream>
+#include <string>
+
+#ifndef ACMIMAGE_H
+#define ACMIMAGE_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFINES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** The first 4 bytes of a binary ACM file ("JACM"). */
+#define _IMAGE_MAGIC						0x4d43414a
+
+/** The version of the binary ACM format. */
+#define _IMAGE_VERSION						1
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * ERRORS MESSAGE
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Message error: the file could not be opened or mapped. */
+#define _IMAGE_ERROR_OPEN					"could not open binary ACM file"
+
+/** Message error: the file is not a binary ACM. */
+#define _IMAGE_ERROR_FORMAT					"not a binary ACM file"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CODE ERRORS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Error code: the file could not be opened or mapped. */
+#define _IMAGE_ERROR_CODE_OPEN				34
+
+/** Error code: the file is not a binary ACM. */
+#define _IMAGE_ERROR_CODE_FORMAT			35
+
+/**
+ * \struct	ImageHeader ACMImage.h
+ * \brief	The header of a binary ACM file.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * All the fields of the file are <code>int</code>s in the byte order of the
+ * machine that wrote it. After the header come, in this order:
+ * 	-#	<code>first</code>: <code>states + 1</code> integers. The arcs
+ * 		leaving the state <i>s</i> are the ones from <code>first[s]</code>
+ * 		to <code>first[s + 1]</code> (excluded), in the order they were
+ * 		created;
+ * 	-#	<code>dest</code>, <code>event</code>, <code>io</code>,
+ * 		<code>channel</code>, <code>cell</code> and <code>slot</code>:
+ * 		<code>arcs</code> integers each, with the destination, the event,
+ * 		the IO type and the channel, cell and slot of the IO operation of
+ * 		each arc (<code>_ARC_NONE</code> if they do not apply);
+ * 	-#	<code>class</code>, <code>process</code> and <code>name</code>:
+ * 		<code>events</code> integers each, with the class (see
+ * 		<b>EventIndex</b>), the process (or <code>_ARC_NONE</code>) and the
+ * 		position of the label in the strings of each event. The events are
+ * 		numbered in the order they first appear in the arcs;
+ * 	-#	<code>processes</code> integers with the position of the label of
+ * 		each process in the strings;
+ * 	-#	the strings: <code>strings</code> bytes of labels ended by a null
+ * 		character;
+ * 	-#	optionally, any other bytes up to the end of the file. They are not
+ * 		part of the <code>ACM</code> (see <code>ACMImage::getTrailer()</code>
+ * 		and <b>ResultCache</b>).
+ */
+struct ImageHeader {
+	
+	/** Must be <code>_IMAGE_MAGIC</code>. */
+	int magic;
+	
+	/** Must be <code>_IMAGE_VERSION</code>. */
+	int version;
+	
+	/** The number of states. */
+	int states;
+	
+	/** The number of arcs. */
+	int arcs;
+	
+	/** The number of events. */
+	int events;
+	
+	/** The number of processes. */
+	int processes;
+	
+	/** The initial state. */
+	int init;
+	
+	/** The position of the label of the model in the strings. */
+	int label;
+	
+	/** The size of the strings, in bytes. */
+	int strings;
+};
+
+/**
+ * \class	ACMImage ACMImage.h
+ * \brief	The <b>ACMImage</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>ACMImage</b> class. A read only view of an <code>ACM</code> saved
+ * in the binary format (see <b>ImageHeader</b> and
+ * <code>StateGraph::acm2binary()</code>). The file is mapped in memory and
+ * the accessors and <code>petrify()</code> (used by <b>jabuti</b>
+ * <code>--load</code> and <code>--cache</code>) read the arcs from the map,
+ * so opening an image does not parse it.
+ * 
+ * The mapped pages still count in the resident memory while they are read,
+ * and <code>toProcess()</code> is not a view: it copies the whole graph into
+ * a new <b>Process</b>, which then takes as much memory as one built by the
+ * parser. Only what reads the image through its accessors saves memory.
+ */
+class ACMImage {
+	
+	public:
+		
+		ACMImage(const char *file);
+		~ACMImage();
+		
+		const char * getLabel();
+		int getStates();
+		int getArcs();
+		int getEvents();
+		int getProcesses();
+		int getInit();
+		
+		int getFirstArc(int state);
+		int getLastArc(int state);
+		int getDest(int arc);
+		int getEvent(int arc);
+		int getIOType(int arc);
+		int getChannel(int arc);
+		int getOnCell(int arc);
+		int getOnSlot(int arc);
+		
+		const char * getEventLabel(int event);
+		int getEventClass(int event);
+		int getEventProcess(int event);
+		const char * getProcessLabel(int proc);
+		string getTrailer();
+		
+		Process * toProcess();
+		void petrify(ostream &out);
+		
+	private:
+		
+		/** The mapped file. */
+		void *Map;
+		
+		/** The size of the mapped file. */
+		size_t bytes;
+		
+		/** The header of the file. */
+		const ImageHeader *Header;
+		
+		/** The first arc of each state (see <b>ImageHeader</b>). */
+		const int *First;
+		
+		/** The arrays of the arcs. */
+		const int *ArcDest, *ArcEvent, *ArcIO, *ArcChannel, *ArcCell, *ArcSlot;
+		
+		/** The arrays of the events. */
+		const int *EventClass, *EventProcess, *EventName;
+		
+		/** The position of the label of each process in the strings. */
+		const int *ProcessName;
+		
+		/** The strings of the labels. */
+		const char *Strings;
+};
+#endif /* ACMIMAGE_H */
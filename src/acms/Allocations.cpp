@@ -0,0 +1,126 @@
+/**
+ * \file		acms/Allocations.cpp
+ * \brief		The methods of the <b>Allocations</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "Allocations.h"
+
+#include <atomic>
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * INITIALIZING VARIABLES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Number of allocations done by the running thread. */
+static thread_local long threadCount = 0;
+
+/** Number of allocations done by all threads. */
+static atomic<long> totalCount(0);
+
+/** Number of bytes allocated by all threads. */
+static atomic<long> totalBytes(0);
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Gets the number of allocations done by the running thread.
+ *
+ * \fn		long Allocations::getCount()
+ * \return	The number of calls to <code>operator new</code> made by the
+ * 			running thread.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+long Allocations::getCount()
+{
+	return threadCount;
+}
+
+/**
+ * \brief	Gets the number of allocations done by all threads.
+ *
+ * \fn		long Allocations::getTotal()
+ * \return	The number of calls to <code>operator new</code>.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+long Allocations::getTotal()
+{
+	return totalCount.load(memory_order_relaxed);
+}
+
+/**
+ * \brief	Gets the number of bytes allocated by all threads.
+ *
+ * \fn		long Allocations::getBytes()
+ * \return	The sum of the sizes asked to <code>operator new</code>. Memory
+ * 			freed is not subtracted.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+long Allocations::getBytes()
+{
+	return totalBytes.load(memory_order_relaxed);
+}
+
+/**
+ * \brief	Gets if the allocations are counted.
+ *
+ * \fn		bool Allocations::isCounting()
+ * \return	<b>true</b> if the program was linked with the counting
+ * 			<code>operator new</code>. <b>false</b> otherwise: then all the
+ * 			counters stay at zero.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool Allocations::isCounting()
+{
+	// the program allocates while it starts, before any query
+	return totalCount.load(memory_order_relaxed) > 0;
+}
+
+/**
+ * \brief	Counts an allocation.
+ *
+ * \fn		void Allocations::count(size_t size)
+ * \param	size: the number of bytes allocated.
+ *
+ * Called by the counting <code>operator new</code> only.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void Allocations::count(size_t size)
+{
+	threadCount++;
+	totalCount.fetch_add(1, memory_order_relaxed);
+	totalBytes.fetch_add(size, memory_order_relaxed);
+}
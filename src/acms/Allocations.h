@@ -0,0 +1,63 @@
+/**
+ * \file		acms/Allocations.h
+ * \brief		The definition of the <b>Allocations</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include <stddef.h>
+
+#ifndef ALLOCATIONS_H
+#define ALLOCATIONS_H
+
+/**
+ * \class	Allocations Allocations.h
+ * \brief	The <b>Allocations</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ *
+ * The <b>Allocations</b> class. Counts the memory allocated with
+ * <code>new</code> by the program. The counting is done by a replacement of
+ * the global <code>operator new</code> (see <code>counting_new.cpp</code>)
+ * that calls <code>count()</code>, both for the calling thread and for the
+ * whole program, before calling <code>malloc()</code>. It is linked only
+ * into <b>jabuti_bench</b>: in the other programs nothing is counted, the
+ * counters stay at zero and reading them costs nothing.
+ *
+ * The counters are never reset: to know how much a piece of code allocates,
+ * read them before and after it.
+ */
+class Allocations {
+
+	public:
+
+		static long getCount();
+		static long getTotal();
+		static long getBytes();
+		static bool isCounting();
+
+		static void count(size_t size);
+};
+#endif /* ALLOCATIONS_H */
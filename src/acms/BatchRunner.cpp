@@ -0,0 +1,580 @@
+/**
+ * \file		acms/BatchRunner.cpp
+ * \brief		The methods of the <b>BatchRunner</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "BatchRunner.h"
+#include "Penknife.h"
+
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new <b>BatchRunner</b> element with
+ * 			the jobs of a manifest.
+ * 
+ * \fn		BatchRunner::BatchRunner(const char *manifest)
+ * \param	*manifest: the name of the manifest.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+BatchRunner::BatchRunner(const char *manifest)
+{
+	Manifest = manifest;
+	Threads = _ACMS_THREADS;
+	Workers = defaultWorkers(Threads);
+	Stream = false;
+	Symmetry = _ACMS_SYMMETRY_NONE;
+	Reduction = false;
+	External = false;
+	ExternalDir = NULL;
+	ExternalMemory = _ACMS_EXTERNAL_MEMORY;
+	
+	readManifest();
+}
+
+/**
+ * \brief	Class destructor.
+ * 
+ * \fn		BatchRunner::~BatchRunner()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+BatchRunner::~BatchRunner()
+{
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Sets the largest number of jobs running at the same time.
+ * 
+ * \fn		void BatchRunner::setWorkers(int n)
+ * \param	n: the number of jobs. At least one.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void BatchRunner::setWorkers(int n)
+{
+	Workers = n > 0 ? n : 1;
+}
+
+/**
+ * \brief	Sets the number of threads of each job.
+ * 
+ * \fn		void BatchRunner::setThreads(int n)
+ * \param	n: the number of threads (see <code>StateGraph::setThreads()</code>).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void BatchRunner::setThreads(int n)
+{
+	Threads = n;
+}
+
+/**
+ * \brief	Sets if the <code>ACM</code>s are written while they are
+ * 			generated.
+ * 
+ * \fn		void BatchRunner::setStream(bool s)
+ * \param	s: see <code>StateGraph::setStream()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void BatchRunner::setStream(bool s)
+{
+	Stream = s;
+}
+
+/**
+ * \brief	Sets the symmetry reduction of the jobs.
+ * 
+ * \fn		void BatchRunner::setSymmetry(int s)
+ * \param	s: see <code>StateGraph::setSymmetry()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void BatchRunner::setSymmetry(int s)
+{
+	Symmetry = s;
+}
+
+/**
+ * \brief	Sets if the jobs use the partial order reduction.
+ * 
+ * \fn		void BatchRunner::setReduction(bool r)
+ * \param	r: see <code>StateGraph::setReduction()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void BatchRunner::setReduction(bool r)
+{
+	Reduction = r;
+}
+
+/**
+ * \brief	Makes the jobs generate the <code>ACM</code>s in external
+ * 			memory.
+ * 
+ * \fn		void BatchRunner::setExternal(const char *dir, long memory)
+ * \param	*dir: the directory of the scratch files.
+ * \param	memory: the memory of each job, in bytes.
+ * 
+ * See <code>StateGraph::setExternal()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void BatchRunner::setExternal(const char *dir, long memory)
+{
+	External = true;
+	ExternalDir = dir;
+	ExternalMemory = memory;
+}
+
+/**
+ * \brief	Runs the jobs and writes a summary of them.
+ * 
+ * \fn		int BatchRunner::run(ostream &summary)
+ * \param	&summary: where the summary is written.
+ * \return	The number of jobs that failed.
+ * 
+ * The jobs are started in the order of the manifest, a new one each time
+ * one finishes. The summary has a line per job, in the same order, with
+ * the size of the <code>ACM</code>, the elapsed, user and system times
+ * and the peak resident set size of the process of the job. The output of
+ * a job that failed is removed.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int BatchRunner::run(ostream &summary)
+{
+	int cont, running = 0, failed = 0;
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	
+	for (cont = 0; cont < Jobs.size() || running > 0; ) {
+		
+		if (cont < Jobs.size() && running < Workers) {
+			
+			start(Jobs[cont++]);
+			running++;
+		} else {
+			
+			finish();
+			running--;
+		}
+	}
+	
+	for (cont = 0; cont < Jobs.size(); cont++) {
+		
+		if (Jobs[cont].status != 0) {
+			
+			unlink(Jobs[cont].output.c_str());
+			failed++;
+		}
+	}
+	
+	chrono::duration<double> wall = chrono::steady_clock::now() - started;
+	
+	report(summary, wall.count());
+	
+	return failed;
+}
+
+/**
+ * \brief	Returns the default number of jobs running at the same time.
+ * 
+ * \fn		int BatchRunner::defaultWorkers(int threads)
+ * \param	threads: the number of threads of each job.
+ * \return	The number of processors divided by the threads of a job, at
+ * 			least one.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int BatchRunner::defaultWorkers(int threads)
+{
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	
+	if (cpus < 1 || threads < 1 || cpus / threads < 1) {
+		
+		return 1;
+	}
+	
+	return cpus / threads;
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PRIVATE METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Reads the jobs of the manifest.
+ * 
+ * \fn		void BatchRunner::readManifest()
+ * 
+ * A line that is not a job is an error, and nothing is run. So is a job
+ * with the same output of an earlier one (as written in the manifest),
+ * since the jobs would overwrite each other and <code>run()</code> removes
+ * the output of the ones that fail.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void BatchRunner::readManifest()
+{
+	ifstream in(Manifest.c_str());
+	string line, policy, extra;
+	set<string> outputs;
+	int number = 0;
+	
+	if (!in) {
+		
+		Penknife::pkerrors(_BATCH_ERROR_OPEN, (char *) Manifest.c_str());
+		exit(_BATCH_ERROR_CODE_MANIFEST);
+	}
+	
+	while (getline(in, line)) {
+		
+		number++;
+		line = line.substr(0, line.find('#'));
+		
+		istringstream fields(line);
+		BatchJob job;
+		
+		if (!(fields >> policy)) {
+			
+			// an empty line or a comment
+			continue;
+		}
+		
+		job.policy = policy == "rrbb" ? _CHANNEL_RRBB \
+						: policy == "owbb" ? _CHANNEL_OWBB \
+						: policy == "owrrbb" ? _CHANNEL_OWRRBB : -1;
+		
+		if (job.policy == -1 || !(fields >> job.cells) || job.cells < 2 \
+				|| !(fields >> job.output) || fields >> extra) {
+			
+			ostringstream where;
+			
+			where << Manifest << ":" << number;
+			Penknife::pkerrors(_BATCH_ERROR_FORMAT, (char *) where.str().c_str());
+			exit(_BATCH_ERROR_CODE_MANIFEST);
+		}
+		
+		if (outputs.insert(job.output).second == false) {
+			
+			ostringstream where;
+			
+			where << Manifest << ":" << number;
+			Penknife::pkerrors(_BATCH_ERROR_DUPLICATE, \
+									(char *) where.str().c_str());
+			exit(_BATCH_ERROR_CODE_MANIFEST);
+		}
+		
+		job.pid = 0;
+		job.pipe = -1;
+		job.status = 0;
+		job.states = 0;
+		job.arcs = 0;
+		job.wall = 0;
+		job.user = 0;
+		job.system = 0;
+		job.rss = 0;
+		
+		Jobs.push_back(job);
+	}
+}
+
+/**
+ * \brief	Starts the process of a job.
+ * 
+ * \fn		void BatchRunner::start(BatchJob &job)
+ * \param	&job: the job.
+ * 
+ * The buffers of the standard streams are flushed first, so the process
+ * does not write them again. The elapsed time of the job counts from
+ * before the process is created.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void BatchRunner::start(BatchJob &job)
+{
+	int fd[2];
+	
+	cout.flush();
+	cerr.flush();
+	fflush(NULL);
+	
+	job.started = chrono::steady_clock::now();
+	
+	if (::pipe(fd) != 0 || (job.pid = fork()) < 0) {
+		
+		Penknife::pkerrors(_BATCH_ERROR_FORK, (char *) job.output.c_str());
+		exit(_BATCH_ERROR_CODE_FORK);
+	}
+	
+	if (job.pid == 0) {
+		
+		close(fd[0]);
+		runJob(job, fd[1]);
+	}
+	
+	close(fd[1]);
+	job.pipe = fd[0];
+}
+
+/**
+ * \brief	Waits for the process of a job to finish and takes its
+ * 			measures.
+ * 
+ * \fn		void BatchRunner::finish()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void BatchRunner::finish()
+{
+	struct rusage usage;
+	int status, cont, sizes[2];
+	pid_t pid;
+	
+	while ((pid = wait4(-1, &status, 0, &usage)) < 0 && errno == EINTR);
+	
+	for (cont = 0; cont < Jobs.size(); cont++) {
+		
+		BatchJob &job = Jobs[cont];
+		
+		if (job.pid != pid || pid <= 0) {
+			
+			continue;
+		}
+		
+		chrono::duration<double> wall = chrono::steady_clock::now() \
+														- job.started;
+		
+		job.pid = 0;
+		job.status = status;
+		job.wall = wall.count();
+		job.user = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6;
+		job.system = usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+		job.rss = usage.ru_maxrss;
+		
+		if (read(job.pipe, sizes, sizeof(sizes)) == sizeof(sizes)) {
+			
+			job.states = sizes[0];
+			job.arcs = sizes[1];
+		}
+		
+		close(job.pipe);
+		job.pipe = -1;
+		
+		break;
+	}
+}
+
+/**
+ * \brief	Synthesizes the <code>ACM</code> of a job. Runs in the process
+ * 			of the job and does not return.
+ * 
+ * \fn		void BatchRunner::runJob(BatchJob &job, int fd)
+ * \param	&job: the job.
+ * \param	fd: the pipe where the number of states and arcs are sent.
+ * 
+ * The comments at the beginning of the <b>petrify</b> file show the
+ * command that writes the same <code>ACM</code> alone. The process ends
+ * with <code>_exit()</code>, so it does not run the handlers and static
+ * destructors it inherited from <b>jabuti</b>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void BatchRunner::runJob(BatchJob &job, int fd)
+{
+	ofstream out(job.output.c_str());
+	string policy = string("--") + policyName(job.policy);
+	ostringstream cells;
+	int sizes[2];
+	
+	if (!out) {
+		
+		Penknife::pkerrors(_BATCH_ERROR_OUTPUT, (char *) job.output.c_str());
+		_exit(_BATCH_ERROR_CODE_OUTPUT);
+	}
+	
+	cells << job.cells;
+	
+	string cell = cells.str();
+	char *cmd[] = {(char *) "jabuti", (char *) policy.c_str(), \
+						(char *) cell.c_str(), NULL};
+	
+	StateGraph *acm = new StateGraph(job.policy, job.cells);
+	
+	acm->setThreads(Threads);
+	acm->setStream(Stream);
+	acm->setSymmetry(Symmetry);
+	acm->setReduction(Reduction);
+	
+	if (External) {
+		
+		acm->setExternal(ExternalDir, ExternalMemory);
+	}
+	
+	cout.rdbuf(out.rdbuf());
+	
+	acm->makeACM();
+	acm->acm2petrify(cmd);
+	cout.flush();
+	
+	out.close();
+	
+	if (out.fail()) {
+		
+		Penknife::pkerrors(_BATCH_ERROR_OUTPUT, (char *) job.output.c_str());
+		_exit(_BATCH_ERROR_CODE_OUTPUT);
+	}
+	
+	sizes[0] = acm->getStates();
+	sizes[1] = acm->getArcs();
+	
+	if (write(fd, sizes, sizeof(sizes)) != sizeof(sizes)) {
+		
+		_exit(_BATCH_ERROR_CODE_OUTPUT);
+	}
+	
+	fflush(NULL);
+	_exit(0);
+}
+
+/**
+ * \brief	Writes the summary of the jobs.
+ * 
+ * \fn		void BatchRunner::report(ostream &summary, double wall)
+ * \param	&summary: where the summary is written.
+ * \param	wall: the elapsed time of the whole batch, in seconds.
+ * 
+ * The summary is in the CSV format, with a line per job. The status is
+ * <code>ok</code>, <code>exit n</code> if the process of the job ended
+ * with the error code <i>n</i> or <code>signal n</code> if it was killed by
+ * the signal <i>n</i>. The last line is a comment with the totals.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void BatchRunner::report(ostream &summary, double wall)
+{
+	int cont, failed = 0;
+	double user = 0, system = 0;
+	long rss = 0;
+	
+	summary << "policy,cells,output,status,states,arcs,wall_s,user_s,sys_s," \
+			<< "peak_rss_kb" << endl;
+	
+	for (cont = 0; cont < Jobs.size(); cont++) {
+		
+		BatchJob &job = Jobs[cont];
+		
+		summary << policyName(job.policy) << "," << job.cells << "," \
+				<< job.output << ",";
+		
+		if (WIFEXITED(job.status) && WEXITSTATUS(job.status) == 0) {
+			
+			summary << "ok";
+		} else if (WIFEXITED(job.status)) {
+			
+			summary << "exit " << WEXITSTATUS(job.status);
+			failed++;
+		} else {
+			
+			summary << "signal " << WTERMSIG(job.status);
+			failed++;
+		}
+		
+		summary << "," << job.states << "," << job.arcs << "," << job.wall \
+				<< "," << job.user << "," << job.system << "," << job.rss \
+				<< endl;
+		
+		user += job.user;
+		system += job.system;
+		rss = job.rss > rss ? job.rss : rss;
+	}
+	
+	summary << "# " << Jobs.size() << " jobs, " << failed << " failed, " \
+			<< Workers << " workers: " << wall << " s elapsed, " << user \
+			<< " s user, " << system << " s sys, " << rss \
+			<< " KB largest peak" << endl;
+}
+
+/**
+ * \brief	Returns the name of a policy, as in the manifest.
+ * 
+ * \fn		const char * BatchRunner::policyName(int policy)
+ * \param	policy: the policy.
+ * \return	<code>rrbb</code>, <code>owbb</code> or <code>owrrbb</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const char * BatchRunner::policyName(int policy)
+{
+	switch (policy) {
+		
+		case _CHANNEL_RRBB:
+			
+			return "rrbb";
+			
+		case _CHANNEL_OWBB:
+			
+			return "owbb";
+			
+		default:
+			
+			return "owrrbb";
+	}
+}
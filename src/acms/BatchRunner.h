@@ -0,0 +1,207 @@
+/**
+ * \file		acms/BatchRunner.h
+ * \brief		The definition of the <b>BatchRunner</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include "StateGraph.h"
+
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * ERRORS MESSAGE
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Message error: the manifest can not be opened. */
+#define _BATCH_ERROR_OPEN					"could not open manifest"
+
+/** Message error: a line of the manifest is not a job. */
+#define _BATCH_ERROR_FORMAT					"wrong job in manifest line"
+
+/** Message error: two jobs of the manifest write the same output. */
+#define _BATCH_ERROR_DUPLICATE				"repeated job output in manifest line"
+
+/** Message error: the output of a job can not be written. */
+#define _BATCH_ERROR_OUTPUT					"could not write job output"
+
+/** Message error: the process of a job can not be created. */
+#define _BATCH_ERROR_FORK					"could not start job"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CODE ERRORS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Error code: the manifest can not be read. */
+#define _BATCH_ERROR_CODE_MANIFEST			39
+
+/** Error code: the output of a job can not be written. */
+#define _BATCH_ERROR_CODE_OUTPUT			40
+
+/** Error code: the process of a job can not be created. */
+#define _BATCH_ERROR_CODE_FORK				41
+
+/** Error code: some job of the batch failed. */
+#define _BATCH_ERROR_CODE_JOBS				42
+
+/**
+ * \struct	BatchJob BatchRunner.h
+ * \brief	A job of a batch: one <code>ACM</code> to synthesize, and what
+ * 			was measured when it was done.
+ */
+struct BatchJob {
+	
+	/** The policy of the channel. */
+	int policy;
+	
+	/** The number of cells of the channel. */
+	int cells;
+	
+	/** The file where the <code>ACM</code> is written. */
+	string output;
+	
+	/** The process running the job. 0 if it is not running. */
+	pid_t pid;
+	
+	/** The pipe where the process sends the size of the <code>ACM</code>.
+	 */
+	int pipe;
+	
+	/** When the process was started. */
+	chrono::steady_clock::time_point started;
+	
+	/** The status of the process, as returned by <code>wait4()</code>. */
+	int status;
+	
+	/** The number of states of the <code>ACM</code>. */
+	int states;
+	
+	/** The number of arcs of the <code>ACM</code>. */
+	int arcs;
+	
+	/** The elapsed time of the job, in seconds. */
+	double wall;
+	
+	/** The user time of the job, in seconds. */
+	double user;
+	
+	/** The system time of the job, in seconds. */
+	double system;
+	
+	/** The peak resident set size of the job, in KB. */
+	long rss;
+};
+
+/**
+ * \class	BatchRunner BatchRunner.h
+ * \brief	The <b>BatchRunner</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>BatchRunner</b> class. Synthesizes the <code>ACM</code>s listed in
+ * a manifest, each one in its own file, and reports the time and the
+ * memory used by each of them.
+ * 
+ * Each line of the manifest is a job: the policy (<code>rrbb</code>,
+ * <code>owbb</code> or <code>owrrbb</code>), the number of cells and the
+ * output file, separated by blanks. Empty lines and the text from a
+ * <code>#</code> to the end of the line are skipped.
+ * 
+ * The jobs run in child processes, at most <code>Workers</code> of them at
+ * the same time. A <b>StateGraph</b> writes to the standard output and uses
+ * class variables, so a process per job keeps the jobs apart, and its
+ * resource usage is the one of the job alone. The processes are forked
+ * from <b>jabuti</b> after it has started, so they do not pay for it
+ * again.
+ */
+class BatchRunner {
+	
+	public:
+		
+		BatchRunner(const char *manifest);
+		~BatchRunner();
+		
+		void setWorkers(int n);
+		void setThreads(int n);
+		void setStream(bool s);
+		void setSymmetry(int s);
+		void setReduction(bool r);
+		void setExternal(const char *dir, long memory);
+		
+		int run(ostream &summary);
+		
+		static int defaultWorkers(int threads);
+		
+	private:
+		
+		/** The name of the manifest. */
+		string Manifest;
+		
+		/** The jobs of the manifest, in order. */
+		vector<BatchJob> Jobs;
+		
+		/** The largest number of jobs running at the same time. */
+		int Workers;
+		
+		/** The number of threads of each job (see
+		 *  <code>StateGraph::setThreads()</code>). */
+		int Threads;
+		
+		/** If the <code>ACM</code>s are written while they are generated. */
+		bool Stream;
+		
+		/** The symmetry reduction of the jobs. */
+		int Symmetry;
+		
+		/** If the jobs use the partial order reduction. */
+		bool Reduction;
+		
+		/** If the jobs generate the <code>ACM</code>s in external memory. */
+		bool External;
+		
+		/** The directory of the scratch files of the external generation.
+		 *  <code>NULL</code> for the default one. */
+		const char *ExternalDir;
+		
+		/** The memory of the external generation, in bytes. */
+		long ExternalMemory;
+		
+		void readManifest();
+		void start(BatchJob &job);
+		void finish();
+		void runJob(BatchJob &job, int fd);
+		void report(ostream &summary, double wall);
+		
+		static const char * policyName(int policy);
+};
+#endif /* BATCHRUNNER_H */
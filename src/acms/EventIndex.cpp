@@ -0,0 +1,193 @@
+/**
+ * \file		acms/EventIndex.cpp
+ * \brief		The methods of the <b>EventIndex</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "EventIndex.h"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new empty <b>EventIndex</b> element.
+ *
+ * \fn		EventIndex::EventIndex()
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+EventIndex::EventIndex()
+{
+	Classes.resize(_EVENTS_DUMMY + 1);
+	InClasses.resize(_EVENTS_DUMMY + 1);
+}
+
+/**
+ * \brief	Class destructor.
+ *
+ * \fn		EventIndex::~EventIndex()
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+EventIndex::~EventIndex()
+{}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Empties the index and sets the processes of the state graph.
+ *
+ * \fn		void EventIndex::setProcesses(vector<Process *> proc)
+ * \param	proc: the processes of the system.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void EventIndex::setProcesses(vector<Process *> proc)
+{
+	int cont;
+
+	Prefixes.clear();
+
+	for (cont = 0; cont < proc.size(); cont++) {
+
+		Prefixes.push_back(proc[cont]->getLabel() + ".");
+	}
+
+	for (cont = 0; cont <= _EVENTS_DUMMY; cont++) {
+
+		Classes[cont].clear();
+		InClasses[cont].clear();
+	}
+
+	ProcessEvents.assign(Prefixes.size(), vector<int>());
+	Known.clear();
+}
+
+/**
+ * \brief	Registers the event of a new arc.
+ *
+ * \fn		void EventIndex::insert(int event, int type)
+ * \param	event: the event of the arc.
+ * \param	type: the IO type of the arc.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void EventIndex::insert(int event, int type)
+{
+	int c = classOf(type);
+
+	if (event >= InClasses[c].size()) {
+
+		InClasses[c].resize(event + 1, false);
+	}
+
+	if (InClasses[c][event] == false) {
+
+		InClasses[c][event] = true;
+		Classes[c].push_back(event);
+	}
+
+	if (event >= Known.size()) {
+
+		Known.resize(event + 1, false);
+	}
+
+	if (Known[event] == false) {
+
+		const string &lab = Arc::Events.getLabel(event);
+
+		Known[event] = true;
+
+		for (int cont = 0; cont < Prefixes.size(); cont++) {
+
+			if (lab.compare(0, Prefixes[cont].size(), Prefixes[cont]) == 0) {
+
+				ProcessEvents[cont].push_back(event);
+			}
+		}
+	}
+}
+
+/**
+ * \brief	Gets the events of a class.
+ *
+ * \fn		vector<int> & EventIndex::getClass(int c)
+ * \param	c: the class (<code>_EVENTS_INTERNAL</code>,
+ * 			<code>_EVENTS_OUTPUTS</code> or <code>_EVENTS_DUMMY</code>).
+ * \return	The events of the class, in the order they first appear.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+vector<int> & EventIndex::getClass(int c)
+{
+	return Classes[c];
+}
+
+/**
+ * \brief	Gets the events of a process.
+ *
+ * \fn		vector<int> & EventIndex::getProcess(int p)
+ * \param	p: the position of the process.
+ * \return	The events of the process, in the order they first appear.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+vector<int> & EventIndex::getProcess(int p)
+{
+	return ProcessEvents[p];
+}
+
+/**
+ * \brief	Gets the class of the events of a type of arc.
+ *
+ * \fn		int EventIndex::classOf(int type)
+ * \param	type: the IO type of the arc.
+ * \return	<code>_EVENTS_INTERNAL</code> for reads and writes,
+ * 			<code>_EVENTS_OUTPUTS</code> for control arcs and
+ * 			<code>_EVENTS_DUMMY</code> otherwise.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int EventIndex::classOf(int type)
+{
+	if (type == _ARC_WRITE || type == _ARC_READ) {
+
+		return _EVENTS_INTERNAL;
+	} else if (type == _ARC_CONTROL) {
+
+		return _EVENTS_OUTPUTS;
+	}
+
+	return _EVENTS_DUMMY;
+}
@@ -0,0 +1,99 @@
+/**
+ * \file		acms/EventIndex.h
+ * \brief		The definition of the <b>EventIndex</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+using namespace std;
+
+#include "config.h"
+
+#include "Arc.h"
+#include "Process.h"
+
+#include <string>
+#include <vector>
+
+#ifndef EVENTINDEX_H
+#define EVENTINDEX_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFINES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** The class of the internal events (reads and writes). */
+#define _EVENTS_INTERNAL					0
+
+/** The class of the output events (control). */
+#define _EVENTS_OUTPUTS						1
+
+/** The class of the dummy events (internal actions of the processes). */
+#define _EVENTS_DUMMY						2
+
+/**
+ * \class	EventIndex EventIndex.h
+ * \brief	The <b>EventIndex</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ *
+ * The <b>EventIndex</b> class. Keeps the events (see <b>EventTable</b>) used
+ * by the arcs of a state graph, by class and by process, in the order they
+ * first appear. It is updated for each new arc, so the headers of a
+ * <b>petrify</b> file can be printed without looking at the arcs again.
+ *
+ * An event belongs to a process if its label starts with the label of the
+ * process followed by a dot.
+ */
+class EventIndex {
+
+	public:
+
+		EventIndex();
+		~EventIndex();
+
+		void setProcesses(vector<Process *> proc);
+		void insert(int event, int type);
+
+		vector<int> & getClass(int c);
+		vector<int> & getProcess(int p);
+
+		static int classOf(int type);
+
+	private:
+
+		/** The prefix (label and a dot) of the events of each process. */
+		vector<string> Prefixes;
+
+		/** The events of each class. */
+		vector<vector<int> > Classes;
+
+		/** Tells, for each class, if an event is already in it. */
+		vector<vector<bool> > InClasses;
+
+		/** The events of each process. */
+		vector<vector<int> > ProcessEvents;
+
+		/** Tells if an event has already been found. */
+		vector<bool> Known;
+};
+#endif /* EVENTINDEX_H */
@@ -0,0 +1,287 @@
+/**
+ * \file		acms/ExplorationStats.cpp
+ * \brief		The methods of the <b>ExplorationStats</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "Allocations.h"
+#include "ExplorationStats.h"
+#include "Penknife.h"
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new <b>ExplorationStats</b> element.
+ *
+ * \fn		ExplorationStats::ExplorationStats(const char *file)
+ * \param	*file: the name of the file where the statistics are written.
+ * 			If it is <code>NULL</code>, they are written to the standard
+ * 			error.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+ExplorationStats::ExplorationStats(const char *file)
+{
+	Out = stderr;
+
+	if (file != NULL && (Out = fopen(file, "w")) == NULL) {
+
+		Penknife::pkerrors(_STATS_ERROR_OPEN, (char *) file);
+		exit(_STATS_ERROR_CODE_OPEN);
+	}
+
+	started = chrono::steady_clock::now();
+	last = started;
+	lastStates = 0;
+	calls = 0;
+}
+
+/**
+ * \brief	Class destructor.
+ *
+ * \fn		ExplorationStats::~ExplorationStats()
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+ExplorationStats::~ExplorationStats()
+{
+	if (Out != stderr) {
+
+		fclose(Out);
+	}
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Starts a phase.
+ *
+ * \fn		void ExplorationStats::begin(const char *phase)
+ * \param	*phase: the name of the phase.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void ExplorationStats::begin(const char *phase)
+{
+	Phases.push_back(phase);
+	Times.push_back(0);
+
+	started = chrono::steady_clock::now();
+	last = started;
+	lastStates = 0;
+	calls = 0;
+}
+
+/**
+ * \brief	Ends the current phase.
+ *
+ * \fn		void ExplorationStats::end()
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void ExplorationStats::end()
+{
+	if (Times.size() > 0) {
+
+		Times.back() = since(started);
+	}
+}
+
+/**
+ * \brief	Tells if it is time to print a progress report.
+ *
+ * \fn		bool ExplorationStats::due()
+ * \return	<b>true</b> if <code>_STATS_INTERVAL</code> seconds passed since
+ * 			the last report.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool ExplorationStats::due()
+{
+	if (++calls < _STATS_CHECK) {
+
+		return false;
+	}
+
+	calls = 0;
+
+	return since(last) >= _STATS_INTERVAL;
+}
+
+/**
+ * \brief	Prints a progress report of the exploration.
+ *
+ * \fn		void ExplorationStats::report(long states, long frontier,
+											long arcs, double load, long bytes)
+ * \param	states: the number of states found.
+ * \param	frontier: the number of states waiting to be expanded.
+ * \param	arcs: the number of arcs found.
+ * \param	load: the load factor of the table of visited states.
+ * \param	bytes: the memory used by the visited states.
+ *
+ * The rate is the one since the previous report.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void ExplorationStats::report(long states, long frontier, long arcs,
+												double load, long bytes)
+{
+	double elapsed = since(last);
+	double rate = elapsed > 0 ? (states - lastStates) / elapsed : 0;
+
+	fprintf(Out, "# %s %.1fs: %ld states, %ld frontier, %ld arcs, "
+		"%.0f states/s, load %.2f, store %ld KB, rss %ld KB\n",
+		Phases.size() > 0 ? Phases.back().c_str() : "", since(started),
+		states, frontier, arcs, rate, load, bytes / 1024, residentKB());
+	fflush(Out);
+
+	last = chrono::steady_clock::now();
+	lastStates = states;
+}
+
+/**
+ * \brief	Prints the summary of the generation.
+ *
+ * \fn		void ExplorationStats::summary(long states, long arcs,
+								double load, long bytes, long allocations)
+ * \param	states: the number of states of the state graph.
+ * \param	arcs: the number of arcs of the state graph.
+ * \param	load: the load factor of the table of visited states.
+ * \param	bytes: the memory used by the visited states.
+ * \param	allocations: the allocations done while generating successors,
+ * 			written only if they are counted (see <b>Allocations</b>).
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void ExplorationStats::summary(long states, long arcs, double load,
+										long bytes, long allocations)
+{
+	struct rusage usage;
+	double total = 0;
+	int cont;
+
+	getrusage(RUSAGE_SELF, &usage);
+
+	fprintf(Out, "# summary\n");
+
+	for (cont = 0; cont < Phases.size(); cont++) {
+
+		fprintf(Out, "#   %-12s %10.3f s\n", Phases[cont].c_str(),
+			Times[cont]);
+		total += Times[cont];
+	}
+
+	fprintf(Out, "#   %-12s %10.3f s\n", "total", total);
+	fprintf(Out, "#   %ld states, %ld arcs", states, arcs);
+
+	for (cont = 0; cont < Phases.size(); cont++) {
+
+		if (Phases[cont] == "exploration" && Times[cont] > 0) {
+
+			fprintf(Out, ", %.0f states/s", states / Times[cont]);
+		}
+	}
+
+	fprintf(Out, "\n");
+	fprintf(Out, "#   load %.2f, store %ld KB, peak rss %ld KB\n", load,
+		bytes / 1024, (long) usage.ru_maxrss);
+
+	if (Allocations::isCounting()) {
+
+		fprintf(Out, "#   %ld allocations while generating successors\n",
+			allocations);
+	}
+
+	fflush(Out);
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PRIVATE METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Gets the time elapsed since a given moment.
+ *
+ * \fn		double ExplorationStats::since(chrono::steady_clock::time_point t)
+ * \param	t: the moment.
+ * \return	The number of seconds elapsed.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+double ExplorationStats::since(chrono::steady_clock::time_point t)
+{
+	chrono::duration<double> d = chrono::steady_clock::now() - t;
+
+	return d.count();
+}
+
+/**
+ * \brief	Gets the resident set size of the program.
+ *
+ * \fn		long ExplorationStats::residentKB()
+ * \return	The memory in use, in KB. Read from <code>/proc</code> when it
+ * 			is available, otherwise the peak is returned.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+long ExplorationStats::residentKB()
+{
+	long size, resident;
+	FILE *f = fopen("/proc/self/statm", "r");
+
+	if (f != NULL) {
+
+		int n = fscanf(f, "%ld %ld", &size, &resident);
+
+		fclose(f);
+
+		if (n == 2) {
+
+			return resident * (sysconf(_SC_PAGESIZE) / 1024);
+		}
+	}
+
+	struct rusage usage;
+
+	getrusage(RUSAGE_SELF, &usage);
+
+	return usage.ru_maxrss;
+}
@@ -0,0 +1,122 @@
+/**
+ * \file		acms/ExplorationStats.h
+ * \brief		The definition of the <b>ExplorationStats</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+
+#ifndef EXPLORATIONSTATS_H
+#define EXPLORATIONSTATS_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFINES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Seconds between two progress reports. */
+#define _STATS_INTERVAL						1.0
+
+/** Number of calls to <code>due()</code> between two looks at the clock. */
+#define _STATS_CHECK						1024
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * ERRORS MESSAGE
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Message error: the statistics file could not be opened. */
+#define _STATS_ERROR_OPEN					"could not open statistics file"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CODE ERRORS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Error code: the statistics file could not be opened. */
+#define _STATS_ERROR_CODE_OPEN				32
+
+/**
+ * \class	ExplorationStats ExplorationStats.h
+ * \brief	The <b>ExplorationStats</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ *
+ * The <b>ExplorationStats</b> class. Reports how the generation of a state
+ * space is going: the time spent in each phase and, during the exploration,
+ * a line every <code>_STATS_INTERVAL</code> seconds with the states found,
+ * the frontier, the arcs, the rate and the memory in use. At the end a
+ * summary is printed.
+ *
+ * The explorer calls <code>due()</code> once per expanded state; it only
+ * looks at the clock every <code>_STATS_CHECK</code> calls, so the cost is
+ * negligible.
+ */
+class ExplorationStats {
+
+	public:
+
+		ExplorationStats(const char *file);
+		~ExplorationStats();
+
+		void begin(const char *phase);
+		void end();
+
+		bool due();
+		void report(long states, long frontier, long arcs, double load,
+															long bytes);
+		void summary(long states, long arcs, double load, long bytes,
+														long allocations);
+
+	private:
+
+		/** Where the statistics are printed. */
+		FILE *Out;
+
+		/** The names of the phases, in the order they were started. */
+		vector<string> Phases;
+
+		/** The seconds spent in each phase. */
+		vector<double> Times;
+
+		/** When the current phase started. */
+		chrono::steady_clock::time_point started;
+
+		/** When the last progress report was printed. */
+		chrono::steady_clock::time_point last;
+
+		/** Number of states at the last progress report. */
+		long lastStates;
+
+		/** Number of calls to <code>due()</code> since the last look at the
+		 *  clock. */
+		int calls;
+
+		double since(chrono::steady_clock::time_point t);
+		static long residentKB();
+};
+#endif /* EXPLORATIONSTATS_H */
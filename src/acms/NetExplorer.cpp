@@ -0,0 +1,427 @@
+/**
+ * \file		acms/NetExplorer.cpp
+ * \brief		The methods of the <b>NetExplorer</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "NetExplorer.h"
+#include "EventIndex.h"
+#include "Penknife.h"
+
+#include <map>
+
+#include <stdlib.h>
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new <b>NetExplorer</b> element.
+ * 
+ * \fn		NetExplorer::NetExplorer(PNmodel *net)
+ * \param	*net: the Petri net. It must not change while the explorer is
+ * 			used.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+NetExplorer::NetExplorer(PNmodel *net) : Matrix(net)
+{
+	int places = Matrix.getPlaces();
+	int transitions = Matrix.getTransitions();
+	map<string, int> events, procs;
+	int t, p;
+	
+	Net = net;
+	bits = _EXPLORER_SAFE_BITS;
+	processes = 0;
+	
+	for (t = 0; t < transitions; t++) {
+		
+		string label = net->getTransitionLabel(t);
+		
+		// the instances of an event are the same event
+		label = label.substr(0, label.find('/'));
+		
+		if (events.find(label) == events.end()) {
+			
+			int type = net->getTransitionType(t);
+			string::size_type dot = label.find('.');
+			
+			events[label] = Labels.size();
+			Labels.push_back(label);
+			
+			if (type == _PN_T_INTERNAL) {
+				
+				EventClass.push_back(_EVENTS_INTERNAL);
+			} else if (type == _PN_T_OUTPUTS) {
+				
+				EventClass.push_back(_EVENTS_OUTPUTS);
+			} else {
+				
+				EventClass.push_back(_EVENTS_DUMMY);
+			}
+			
+			if (dot == string::npos) {
+				
+				EventProcess.push_back(_ARC_NONE);
+			} else {
+				
+				string proc = label.substr(0, dot);
+				
+				if (procs.find(proc) == procs.end()) {
+					
+					procs[proc] = processes++;
+				}
+				
+				EventProcess.push_back(procs[proc]);
+			}
+		}
+		
+		Event.push_back(events[label]);
+	}
+	
+	// the transitions by their first input place
+	TriggerFirst.assign(places + 1, 0);
+	
+	for (t = 0; t < transitions; t++) {
+		
+		if (Matrix.getFirstPre(t) == Matrix.getLastPre(t)) {
+			
+			Sources.push_back(t);
+		} else {
+			
+			TriggerFirst[Matrix.getPrePlace(Matrix.getFirstPre(t)) + 1]++;
+		}
+	}
+	
+	for (p = 0; p < places; p++) {
+		
+		TriggerFirst[p + 1] += TriggerFirst[p];
+	}
+	
+	vector<int> next(TriggerFirst.begin(), TriggerFirst.end() - 1);
+	
+	Trigger.resize(transitions - Sources.size());
+	
+	for (t = 0; t < transitions; t++) {
+		
+		if (Matrix.getFirstPre(t) != Matrix.getLastPre(t)) {
+			
+			Trigger[next[Matrix.getPrePlace(Matrix.getFirstPre(t))]++] = t;
+		}
+	}
+}
+
+/**
+ * \brief	Class destructor.
+ * 
+ * \fn		NetExplorer::~NetExplorer()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+NetExplorer::~NetExplorer()
+{}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Sets the directory of the temporary file with the graph.
+ * 
+ * \fn		void NetExplorer::setDirectory(const char *dir)
+ * \param	*dir: the directory. <code>NULL</code> for the one of
+ * 			<code>tmpfile()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void NetExplorer::setDirectory(const char *dir)
+{
+	Writer.setDirectory(dir);
+}
+
+/**
+ * \brief	Generates the reachability graph.
+ * 
+ * \fn		void NetExplorer::explore()
+ * 
+ * If the net is not safe, the graph is generated again with one byte per
+ * place. If a place gets more tokens than a byte can keep, the program
+ * stops with <code>_EXPLORER_ERROR_CODE_BOUND</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void NetExplorer::explore()
+{
+	bits = _EXPLORER_SAFE_BITS;
+	
+	while (run() == false) {
+		
+		if (bits == _EXPLORER_BOUNDED_BITS) {
+			
+			Penknife::pkerrors(_EXPLORER_ERROR_BOUND, \
+				(char *) Net->getLabel().c_str());
+			exit(_EXPLORER_ERROR_CODE_BOUND);
+		}
+		
+		bits = _EXPLORER_BOUNDED_BITS;
+	}
+}
+
+/**
+ * \brief	Gets the number of states of the graph.
+ * 
+ * \fn		int NetExplorer::getStates()
+ * \return	The number of reachable markings.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int NetExplorer::getStates()
+{
+	return Writer.getStates();
+}
+
+/**
+ * \brief	Gets the number of arcs of the graph.
+ * 
+ * \fn		int NetExplorer::getArcs()
+ * \return	The number of arcs.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int NetExplorer::getArcs()
+{
+	return Writer.getArcs();
+}
+
+/**
+ * \brief	Gets the size of a place in the markings.
+ * 
+ * \fn		int NetExplorer::getBits()
+ * \return	<code>_EXPLORER_SAFE_BITS</code> if the net is safe.
+ * 			<code>_EXPLORER_BOUNDED_BITS</code> otherwise.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int NetExplorer::getBits()
+{
+	return bits;
+}
+
+/**
+ * \brief	Writes the graph in the format of <b>petrify</b>.
+ * 
+ * \fn		void NetExplorer::petrify(ostream &out)
+ * \param	out: where the graph is written.
+ * 
+ * The comments are not written (see
+ * <code>StateGraph::petrifyComments()</code>). The lists of events only have
+ * the events of some arc, as in an <code>ACM</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void NetExplorer::petrify(ostream &out)
+{
+	const char *heads[] = {".internal", ".outputs", ".dummy"};
+	int cont, c2;
+	
+	out << ".model " << Net->getLabel() << endl;
+	
+	for (cont = _EVENTS_INTERNAL; cont <= _EVENTS_DUMMY; cont++) {
+		
+		if (Classes[cont].size() > 0) {
+			
+			out << heads[cont];
+			
+			for (c2 = 0; c2 < Classes[cont].size(); c2++) {
+				
+				out << " " << Labels[Classes[cont][c2]];
+			}
+			
+			out << endl;
+		}
+	}
+	
+	for (cont = 0; cont < processes; cont++) {
+		
+		out << ".process " << cont;
+		
+		for (c2 = 0; c2 < ProcessEvents[cont].size(); c2++) {
+			
+			out << " " << Labels[ProcessEvents[cont][c2]];
+		}
+		
+		out << endl;
+	}
+	
+	Writer.writeGraph(out);
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PRIVATE METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Generates the reachability graph with the current size of the
+ * 			places.
+ * 
+ * \fn		bool NetExplorer::run()
+ * \return	<b>false</b> if a place got more tokens than <code>bits</code>
+ * 			can keep. <b>true</b> otherwise.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool NetExplorer::run()
+{
+	int places = Matrix.getPlaces();
+	int state, p, c;
+	vector<int> m;
+	
+	Store.setFields(vector<int>(places, bits));
+	Writer.open();
+	
+	Classes.assign(_EVENTS_DUMMY + 1, vector<int>());
+	ProcessEvents.assign(processes, vector<int>());
+	Fired.assign(Labels.size(), false);
+	
+	for (p = 0; p < places; p++) {
+		
+		if (Matrix.getMarking()[p] >= (1 << bits)) {
+			
+			return false;
+		}
+	}
+	
+	Store.insert(Matrix.getMarking());
+	Writer.insertState();
+	
+	// the store is the queue: the markings are numbered as they are found
+	for (state = 0; state < Store.size(); state++) {
+		
+		Store.get(state, m);
+		
+		for (p = 0; p < places; p++) {
+			
+			if (m[p] == 0) {
+				
+				continue;
+			}
+			
+			for (c = TriggerFirst[p]; c < TriggerFirst[p + 1]; c++) {
+				
+				if (Matrix.isEnabled(Trigger[c], m) \
+					&& successor(state, Trigger[c], m) == false) {
+					
+					return false;
+				}
+			}
+		}
+		
+		for (c = 0; c < Sources.size(); c++) {
+			
+			if (successor(state, Sources[c], m) == false) {
+				
+				return false;
+			}
+		}
+	}
+	
+	return true;
+}
+
+/**
+ * \brief	Fires a transition and adds the arc to the graph.
+ * 
+ * \fn		bool NetExplorer::successor(int state, int t, const vector<int> &m)
+ * \param	state: the marking where <i>t</i> is fired.
+ * \param	t: the transition. It must be enabled in <i>m</i>.
+ * \param	m: the tokens of <i>state</i>.
+ * \return	<b>false</b> if a place gets more tokens than <code>bits</code>
+ * 			can keep. <b>true</b> otherwise.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool NetExplorer::successor(int state, int t, const vector<int> &m)
+{
+	Next = m;
+	Matrix.fire(t, Next);
+	
+	for (int e = Matrix.getFirstEffect(t); e < Matrix.getLastEffect(t); e++) {
+		
+		if (Next[Matrix.getEffectPlace(e)] >= (1 << bits)) {
+			
+			return false;
+		}
+	}
+	
+	int succ = Store.insert(Next);
+	
+	if (succ == Writer.getStates()) {
+		
+		Writer.insertState();
+	}
+	
+	Writer.insertArc(state, Labels[Event[t]], succ);
+	fired(t);
+	
+	return true;
+}
+
+/**
+ * \brief	Adds the event of a transition to the lists of events.
+ * 
+ * \fn		void NetExplorer::fired(int t)
+ * \param	t: the transition that was fired.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void NetExplorer::fired(int t)
+{
+	int event = Event[t];
+	
+	if (Fired[event]) {
+		
+		return;
+	}
+	
+	Fired[event] = true;
+	Classes[EventClass[event]].push_back(event);
+	
+	if (EventProcess[event] != _ARC_NONE) {
+		
+		ProcessEvents[EventProcess[event]].push_back(event);
+	}
+}
@@ -0,0 +1,169 @@
+/**
+ * \file		acms/NetExplorer.h
+ * \brief		The definition of the <b>NetExplorer</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include "PNmatrix.h"
+#include "PNmodel.h"
+#include "PetrifyWriter.h"
+#include "StateStore.h"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#ifndef NETEXPLORER_H
+#define NETEXPLORER_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFINES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** The bits of a place in the markings of a safe net. */
+#define _EXPLORER_SAFE_BITS					1
+
+/** The bits of a place in the markings of a bounded net. */
+#define _EXPLORER_BOUNDED_BITS				8
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * ERRORS MESSAGE
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Message error: a place has more tokens than a marking can keep. */
+#define _EXPLORER_ERROR_BOUND				"place with more than 255 tokens"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CODE ERRORS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Error code: a place has more tokens than a marking can keep. */
+#define _EXPLORER_ERROR_CODE_BOUND			43
+
+/**
+ * \class	NetExplorer NetExplorer.h
+ * \brief	The <b>NetExplorer</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>NetExplorer</b> class. Generates the reachability graph of a
+ * <b>PNmodel</b> and writes it in the format of <b>petrify</b>, as
+ * <code>StateGraph::acm2petrify()</code> writes an <code>ACM</code>. So the
+ * graph of the net of an <code>ACM</code> (see
+ * <code>StateGraph::acm2petrinet()</code>) can be compared with it.
+ * 
+ * The markings are kept in a <b>StateStore</b>, with one bit per place
+ * while the net is safe. If a place gets a second token, the exploration
+ * starts again with one byte per place. The markings are expanded in the
+ * order they are found, so the store is also the queue. The transitions
+ * are looked for in the lists of their first input place, and only the
+ * lists of the marked places are looked at.
+ * 
+ * The arcs are labelled by the events of the transitions, that is their
+ * labels without the instance (<code>e/1</code> is <code>e</code>). The
+ * events of a process are the ones that start with its label and a dot,
+ * and the processes are numbered in the order their first transitions
+ * were inserted in the net.
+ */
+class NetExplorer {
+	
+	public:
+		
+		NetExplorer(PNmodel *net);
+		~NetExplorer();
+		
+		void setDirectory(const char *dir);
+		
+		void explore();
+		
+		int getStates();
+		int getArcs();
+		int getBits();
+		
+		void petrify(ostream &out);
+		
+	private:
+		
+		/** The net. */
+		PNmodel *Net;
+		
+		/** The arcs of the net. */
+		PNmatrix Matrix;
+		
+		/** The markings found. */
+		StateStore Store;
+		
+		/** The arcs of the graph. */
+		PetrifyWriter Writer;
+		
+		/** The bits of a place in the markings. */
+		int bits;
+		
+		/** The event of each transition. */
+		vector<int> Event;
+		
+		/** The labels of the events. */
+		vector<string> Labels;
+		
+		/** The class (<code>_EVENTS_INTERNAL</code>, ...) of each event. */
+		vector<int> EventClass;
+		
+		/** The process of each event. */
+		vector<int> EventProcess;
+		
+		/** The number of processes. */
+		int processes;
+		
+		/** The first entry of each place in <code>Trigger</code>, plus the
+		 *  end of the last one. */
+		vector<int> TriggerFirst;
+		
+		/** The transitions whose first input place is each place. */
+		vector<int> Trigger;
+		
+		/** The transitions without input places. */
+		vector<int> Sources;
+		
+		/** The events of each class, in the order they were fired first. */
+		vector<vector<int> > Classes;
+		
+		/** The events of each process, in the order they were fired first. */
+		vector<vector<int> > ProcessEvents;
+		
+		/** Tells if an event has already been fired. */
+		vector<bool> Fired;
+		
+		/** This is an auxiliary vector to avoid using many memory. */
+		vector<int> Next;
+		
+		bool run();
+		bool successor(int state, int t, const vector<int> &m);
+		void fired(int t);
+		
+		NetExplorer(const NetExplorer &);
+		NetExplorer & operator=(const NetExplorer &);
+};
+#endif /* NETEXPLORER_H */
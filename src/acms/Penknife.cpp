@@ -28,6 +28,10 @@ using namespace std;
 #include "Penknife.h"
 
 #include <iostream>
+#include <string>
+
+#include <stdlib.h>
+#include <unistd.h>
 
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * PUBLIC METHODS
@@ -83,3 +87,46 @@ void Penknife::pkerrors(char *m, char *f)
 {
 	cerr << m << " <" << f << ">" << endl;
 }
+
+/**
+ * \brief       Creates a scratch file.
+ * 
+ * \fn          static FILE * Penknife::pkscratch(const char *d)
+ * \param       *d: the directory of the file. If it is <code>NULL</code>,
+ * 				the one of <code>tmpfile()</code> is used.
+ * \return      The file, opened for reading and writing. It is removed
+ * 				from the directory at once, so it has no name and is
+ * 				deleted when it is closed or the program ends.
+ * 
+ * \author      agent (agent@local)
+ * \date        17/10/2026
+ */
+FILE * Penknife::pkscratch(const char *d)
+{
+	FILE *f = NULL;
+	
+	if (d == NULL) {
+		
+		f = tmpfile();
+	} else {
+		
+		string path = d;
+		path.append("/jabutiXXXXXX");
+		
+		int fd = mkstemp(&path[0]);
+		
+		if (fd != -1) {
+			
+			unlink(path.c_str());
+			f = fdopen(fd, "w+");
+		}
+	}
+	
+	if (f == NULL) {
+		
+		pkerrors(_PK_ERROR_SCRATCH, (char *) (d == NULL ? "tmpfile()" : d));
+		exit(_PK_ERROR_CODE_SCRATCH);
+	}
+	
+	return f;
+}
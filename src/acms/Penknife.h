@@ -29,6 +29,8 @@ using namespace std;
 
 //#include <iostream>
 
+#include <stdio.h>
+
 #ifndef PENKNIFE_H
 #define PENKNIFE_H
 
@@ -39,6 +41,16 @@ using namespace std;
 /** Message error: error when opening file. */
 #define _PK_ERROR_OPEN_FILE				"error opening input file"
 
+/** Message error: a scratch file could not be created. */
+#define _PK_ERROR_SCRATCH				"could not create scratch file"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CODE ERRORS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Error code: a scratch file could not be created. */
+#define _PK_ERROR_CODE_SCRATCH			33
+
 /**
  * \class	Penknife Penknife.h
  * \brief	The <b>Penknife</b> class.
@@ -56,5 +68,6 @@ class Penknife {
 		~Penknife();							/* class destructor */
 		static void pkerrors(char *m);			/* prints error message */
 		static void pkerrors(char *m, char *f);	/* prints error message */	
+		static FILE * pkscratch(const char *d);	/* opens a scratch file */
 };
 #endif /* PENKNIFE_H */
@@ -0,0 +1,223 @@
+/**
+ * \file		acms/PetrifyWriter.cpp
+ * \brief		The methods of the <b>PetrifyWriter</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "PetrifyWriter.h"
+#include "Penknife.h"
+
+#include <stdlib.h>
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new <b>PetrifyWriter</b> element.
+ * 
+ * \fn		PetrifyWriter::PetrifyWriter()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+PetrifyWriter::PetrifyWriter()
+{
+	Body = NULL;
+	Buffer = NULL;
+	Directory = NULL;
+	states = 0;
+	arcs = 0;
+}
+
+/**
+ * \brief	Class destructor.
+ * 
+ * \fn		PetrifyWriter::~PetrifyWriter()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+PetrifyWriter::~PetrifyWriter()
+{
+	close();
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Starts a new state graph.
+ * 
+ * \fn		void PetrifyWriter::open()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PetrifyWriter::open()
+{
+	close();
+	
+	if (Directory != NULL) {
+		
+		Body = Penknife::pkscratch(Directory);
+	} else if ((Body = tmpfile()) == NULL) {
+		
+		Penknife::pkerrors(_WRITER_ERROR_TMPFILE, "tmpfile()");
+		exit(_WRITER_ERROR_CODE_TMPFILE);
+	}
+	
+	Buffer = new char[_WRITER_BUFFER];
+	setvbuf(Body, Buffer, _IOFBF, _WRITER_BUFFER);
+}
+
+/**
+ * \brief	Discards the state graph.
+ * 
+ * \fn		void PetrifyWriter::close()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PetrifyWriter::close()
+{
+	if (Body != NULL) {
+		
+		fclose(Body);
+		Body = NULL;
+	}
+	
+	delete [] Buffer;
+	Buffer = NULL;
+	
+	states = 0;
+	arcs = 0;
+}
+
+/**
+ * \brief	Sets the directory of the temporary file.
+ * 
+ * \fn		void PetrifyWriter::setDirectory(const char *dir)
+ * \param	*dir: the directory. <code>NULL</code> for the one of
+ * 			<code>tmpfile()</code>. It is used from the next
+ * 			<code>open()</code> on.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PetrifyWriter::setDirectory(const char *dir)
+{
+	Directory = dir;
+}
+
+/**
+ * \brief	Adds a new state to the state graph.
+ * 
+ * \fn		int PetrifyWriter::insertState()
+ * \return	The target of the new state. Its label is the target itself.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PetrifyWriter::insertState()
+{
+	return states++;
+}
+
+/**
+ * \brief	Writes an arc of the state graph.
+ * 
+ * \fn		void PetrifyWriter::insertArc(int src, const string &lab, int dest)
+ * \param	src: the target of the source state.
+ * \param	lab: the label of the arc.
+ * \param	dest: the target of the destination state.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PetrifyWriter::insertArc(int src, const string &lab, int dest)
+{
+	fprintf(Body, "s%d %s s%d\n", src, lab.c_str(), dest);
+	arcs++;
+}
+
+/**
+ * \brief	Gets the number of states of the state graph.
+ * 
+ * \fn		int PetrifyWriter::getStates()
+ * \return	The number of states.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PetrifyWriter::getStates()
+{
+	return states;
+}
+
+/**
+ * \brief	Gets the number of arcs of the state graph.
+ * 
+ * \fn		int PetrifyWriter::getArcs()
+ * \return	The number of arcs.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PetrifyWriter::getArcs()
+{
+	return arcs;
+}
+
+/**
+ * \brief	Prints the <code>.state graph</code> section.
+ * 
+ * \fn		void PetrifyWriter::writeGraph(ostream &out)
+ * \param	out: where to print.
+ * 
+ * The lines are copied from the temporary file, so this can be done only
+ * once.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PetrifyWriter::writeGraph(ostream &out)
+{
+	size_t n;
+	vector<char> block(_WRITER_BUFFER);
+	
+	out << ".state graph" << " # begin state graph" << endl;
+	
+	fflush(Body);
+	rewind(Body);
+	
+	while ((n = fread(&block[0], 1, block.size(), Body)) > 0) {
+		
+		out.write(&block[0], n);
+	}
+	
+	out << ".marking{s0}" << endl;
+	out << ".end" << " # end state graph" << endl;
+}
@@ -0,0 +1,114 @@
+/**
+ * \file		acms/PetrifyWriter.h
+ * \brief		The definition of the <b>PetrifyWriter</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+using namespace std;
+
+#include "config.h"
+
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+
+#ifndef PETRIFYWRITER_H
+#define PETRIFYWRITER_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFINES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Size of the buffer of the temporary file with the state graph. */
+#define _WRITER_BUFFER						(1 << 20)
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * ERRORS MESSAGE
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Message error: the temporary file could not be created. */
+#define _WRITER_ERROR_TMPFILE				"could not create temporary file"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CODE ERRORS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Error code: the temporary file could not be created. */
+#define _WRITER_ERROR_CODE_TMPFILE			31
+
+/**
+ * \class	PetrifyWriter PetrifyWriter.h
+ * \brief	The <b>PetrifyWriter</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>PetrifyWriter</b> class. Writes a state graph in the format of
+ * <b>petrify</b> while it is generated, without keeping its arcs in memory.
+ * 
+ * The lines of the <code>.state graph</code> section are written to a
+ * buffered temporary file as soon as the arcs are found. When the graph is
+ * complete, <code>writeGraph()</code> copies the temporary file. The events
+ * of the header are kept apart, by an <b>EventIndex</b>.
+ */
+class PetrifyWriter {
+	
+	public:
+		
+		PetrifyWriter();
+		~PetrifyWriter();
+		
+		void open();
+		void close();
+		
+		void setDirectory(const char *dir);
+		
+		int insertState();
+		void insertArc(int src, const string &lab, int dest);
+		
+		int getStates();
+		int getArcs();
+		
+		void writeGraph(ostream &out);
+		
+	private:
+		
+		/** The temporary file with the lines of the state graph. */
+		FILE *Body;
+		
+		/** The buffer of <code>Body</code>. */
+		char *Buffer;
+		
+		/** The directory of <code>Body</code>. <code>NULL</code> for the
+		 *  one of <code>tmpfile()</code>. */
+		const char *Directory;
+		
+		/** Number of states written. */
+		int states;
+		
+		/** Number of arcs written. */
+		int arcs;
+};
+#endif /* PETRIFYWRITER_H */
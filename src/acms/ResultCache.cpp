@@ -0,0 +1,379 @@
+/**
+ * \file		acms/ResultCache.cpp
+ * \brief		The methods of the <b>ResultCache</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "ResultCache.h"
+#include "Penknife.h"
+
+#include <sstream>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new <b>ResultCache</b> element.
+ * 
+ * \fn		ResultCache::ResultCache(const char *dir)
+ * \param	*dir: the directory of the cache. It is created if it does not
+ * 			exist.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+ResultCache::ResultCache(const char *dir)
+{
+	Directory = dir;
+	Lock = -1;
+	
+	if (mkdir(dir, 0777) != 0 && errno != EEXIST) {
+		
+		fail(Directory);
+	}
+}
+
+/**
+ * \brief	Class destructor. Releases the lock and removes the file being
+ * 			written, if it was not stored.
+ * 
+ * \fn		ResultCache::~ResultCache()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+ResultCache::~ResultCache()
+{
+	if (Temporary.size() > 0) {
+		
+		unlink(Temporary.c_str());
+	}
+	
+	unlock();
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Sets the <code>ACM</code> looked for in the cache.
+ * 
+ * \fn		void ResultCache::setKey(StateGraph *acm)
+ * \param	*acm: the state graph, before <code>makeACM()</code>.
+ * 
+ * The key is a description of all that changes the <code>ACM</code>: the
+ * version of <b>jabuti</b>, the reductions, the channels (label, policy,
+ * cells and slots) and the processes (label, number of states and arcs, in
+ * order). The reductions in the key are the ones <code>makeACM()</code>
+ * applies: the external generation does neither, and the partial order
+ * reduction is only done by one thread without symmetry reduction (see
+ * <code>StateGraph::setReduction()</code>). Beyond that, the number of
+ * threads and the way the state space is stored do not change the result,
+ * so they are not in the key. The file is named after two 64 bits hashes
+ * of the key.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void ResultCache::setKey(StateGraph *acm)
+{
+	int cont, c2;
+	ostringstream key, name;
+	vector<Channel *> channels = acm->getChannels();
+	vector<Process *> processes = acm->getProcesses();
+	int symmetry = acm->getSymmetry();
+	bool reduction = acm->getReduction();
+	
+	if (acm->getExternal()) {
+		
+		symmetry = _ACMS_SYMMETRY_NONE;
+		reduction = false;
+	} else if (symmetry != _ACMS_SYMMETRY_NONE || acm->getThreads() > 1) {
+		
+		reduction = false;
+	}
+	
+	key << "jabuti " << _acms_version << "\n";
+	key << "symmetry " << symmetry << "\n";
+	key << "reduction " << reduction << "\n";
+	
+	for (cont = 0; cont < channels.size(); cont++) {
+		
+		key << "channel " << channels[cont]->getLabel() << " " \
+			<< channels[cont]->getType() << " " << channels[cont]->getCells() \
+			<< " " << channels[cont]->getSlots() << "\n";
+	}
+	
+	for (cont = 0; cont < processes.size(); cont++) {
+		
+		Process *p = processes[cont];
+		
+		key << "process " << p->getLabel() << " " << p->States.size() << "\n";
+		
+		for (c2 = 0; c2 < p->Arcs.size(); c2++) {
+			
+			key << "arc " << p->Arcs[c2]->getSrc() << " " \
+				<< p->Arcs[c2]->getDest() << " " << p->Arcs[c2]->getIOType() \
+				<< " " << p->Arcs[c2]->getChannel() << " " \
+				<< p->Arcs[c2]->getLabel() << "\n";
+		}
+	}
+	
+	Key = key.str();
+	
+	name << hex;
+	name.fill('0');
+	name.width(16);
+	name << hash(Key, 14695981039346656037ULL);
+	name.width(16);
+	name << hash(Key, 14695981039346656037ULL ^ 0x9e3779b97f4a7c15ULL);
+	
+	File = Directory + "/" + name.str() + ".acm";
+}
+
+/**
+ * \brief	Gets the key of the <code>ACM</code> (see <code>setKey()</code>).
+ * 
+ * \fn		const string & ResultCache::getKey()
+ * \return	The key.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const string & ResultCache::getKey()
+{
+	return Key;
+}
+
+/**
+ * \brief	Gets the file of the <code>ACM</code> in the cache.
+ * 
+ * \fn		const string & ResultCache::getFile()
+ * \return	The name of the file. It may not exist (see <code>load()</code>).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const string & ResultCache::getFile()
+{
+	return File;
+}
+
+/**
+ * \brief	Looks for the <code>ACM</code> in the cache.
+ * 
+ * \fn		ACMImage * ResultCache::load()
+ * \return	The image of its file, or <b>NULL</b> if there is no file or it
+ * 			was stored for another key with the same name. Then it must be
+ * 			synthesized and stored again, which replaces the file. The file
+ * 			is complete, since the files are only renamed into the cache
+ * 			once written.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+ACMImage * ResultCache::load()
+{
+	struct stat st;
+	ACMImage *image;
+	
+	if (stat(File.c_str(), &st) != 0 || S_ISREG(st.st_mode) == false) {
+		
+		return NULL;
+	}
+	
+	image = new ACMImage(File.c_str());
+	
+	if (image->getTrailer() != Key) {
+		
+		delete image;
+		return NULL;
+	}
+	
+	return image;
+}
+
+/**
+ * \brief	Locks the <code>ACM</code>, so only one process synthesizes it.
+ * 
+ * \fn		void ResultCache::lock()
+ * 
+ * Waits until no other process holds the lock. The lock is released by
+ * <code>unlock()</code> or when the process ends, so it is never left
+ * behind. <code>load()</code> must be tried again once locked: the
+ * <code>ACM</code> may have been stored while waiting.
+ * 
+ * The lock is taken on an empty file next to the one of the
+ * <code>ACM</code>, with the <code>.lock</code> extension. It is not
+ * removed afterwards, since another process may be waiting on it, so the
+ * directory keeps one for each <code>ACM</code> ever synthesized. They are
+ * reused by the next ones and can be deleted when no <b>jabuti</b> is
+ * using the cache.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void ResultCache::lock()
+{
+	string path = File + ".lock";
+	
+	Lock = open(path.c_str(), O_RDWR | O_CREAT, 0666);
+	
+	if (Lock == -1 || flock(Lock, LOCK_EX) != 0) {
+		
+		fail(path);
+	}
+}
+
+/**
+ * \brief	Unlocks the <code>ACM</code> (see <code>lock()</code>).
+ * 
+ * \fn		void ResultCache::unlock()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void ResultCache::unlock()
+{
+	if (Lock != -1) {
+		
+		flock(Lock, LOCK_UN);
+		close(Lock);
+		Lock = -1;
+	}
+}
+
+/**
+ * \brief	Creates the file where the <code>ACM</code> is written.
+ * 
+ * \fn		const char * ResultCache::create()
+ * \return	The name of a new empty file in the directory of the cache. The
+ * 			<code>ACM</code> is written there (see
+ * 			<code>StateGraph::acm2binary()</code>) and then moved into the
+ * 			cache by <code>store()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const char * ResultCache::create()
+{
+	Temporary = File + ".XXXXXX";
+	
+	int fd = mkstemp(&Temporary[0]);
+	
+	if (fd == -1) {
+		
+		fail(Temporary);
+	}
+	
+	close(fd);
+	
+	return Temporary.c_str();
+}
+
+/**
+ * \brief	Moves the file written after <code>create()</code> into the
+ * 			cache.
+ * 
+ * \fn		void ResultCache::store()
+ * 
+ * The key is appended after the <code>ACM</code> (see <code>load()</code>),
+ * the file is synchronized to the disk and then renamed, which replaces the
+ * file of the <code>ACM</code> at once. So the other processes see either
+ * no file or the complete one.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void ResultCache::store()
+{
+	int fd = open(Temporary.c_str(), O_WRONLY | O_APPEND);
+	
+	if (fd == -1 || write(fd, Key.data(), Key.size()) != (ssize_t) Key.size() \
+		|| fsync(fd) != 0) {
+		
+		fail(Temporary);
+	}
+	
+	close(fd);
+	
+	if (rename(Temporary.c_str(), File.c_str()) != 0) {
+		
+		fail(File);
+	}
+	
+	Temporary.clear();
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PRIVATE METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Hash function of the keys (FNV-1a, 64 bits).
+ * 
+ * \fn		static unsigned long long ResultCache::hash(const string &s,
+ * 												unsigned long long h)
+ * \param	s: the string.
+ * \param	h: the initial value of the hash.
+ * \return	The hash value of <i>s</i>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+unsigned long long ResultCache::hash(const string &s, unsigned long long h)
+{
+	for (int cont = 0; cont < s.size(); cont++) {
+		
+		h ^= (unsigned char) s[cont];
+		h *= 1099511628211ULL;
+	}
+	
+	return h;
+}
+
+/**
+ * \brief	Stops the program when the cache can not be used.
+ * 
+ * \fn		void ResultCache::fail(const string &path)
+ * \param	path: the file or directory that failed.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void ResultCache::fail(const string &path)
+{
+	Penknife::pkerrors(_CACHE_ERROR_DIR, (char *) path.c_str());
+	exit(_CACHE_ERROR_CODE_DIR);
+}
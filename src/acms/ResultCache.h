@@ -0,0 +1,109 @@
+/**
+ * \file		acms/ResultCache.h
+ * \brief		The definition of the <b>ResultCache</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include "ACMImage.h"
+#include "StateGraph.h"
+
+#include <string>
+
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * ERRORS MESSAGE
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Message error: the cache directory can not be used. */
+#define _CACHE_ERROR_DIR					"could not use cache directory"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CODE ERRORS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Error code: the cache directory can not be used. */
+#define _CACHE_ERROR_CODE_DIR				38
+
+/**
+ * \class	ResultCache ResultCache.h
+ * \brief	The <b>ResultCache</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>ResultCache</b> class. Keeps the synthesized <code>ACM</code>s in
+ * a directory, in the binary format (see <b>ACMImage</b>), so the same
+ * synthesis is not done twice.
+ * 
+ * The name of a file is a hash of everything the <code>ACM</code> depends
+ * on (see <code>setKey()</code>), and the description itself is saved after
+ * the <code>ACM</code> (see <code>ACMImage::getTrailer()</code>), so two
+ * descriptions with the same hash do not get each other's <code>ACM</code>.
+ * A file is written with another name and renamed when it is complete, so
+ * the ones that can be found are always complete. Many processes may share
+ * the directory: <code>lock()</code> lets only one of them synthesize each
+ * <code>ACM</code> and the others wait for it.
+ */
+class ResultCache {
+	
+	public:
+		
+		ResultCache(const char *dir);
+		~ResultCache();
+		
+		void setKey(StateGraph *acm);
+		const string & getKey();
+		const string & getFile();
+		
+		ACMImage * load();
+		void lock();
+		void unlock();
+		const char * create();
+		void store();
+		
+	private:
+		
+		/** The directory of the cache. */
+		string Directory;
+		
+		/** The description of the <code>ACM</code> (see
+		 *  <code>setKey()</code>). */
+		string Key;
+		
+		/** The file of the <code>ACM</code> in the cache. */
+		string File;
+		
+		/** The file being written (see <code>create()</code>). */
+		string Temporary;
+		
+		/** The descriptor of the lock file. -1 if it is not locked. */
+		int Lock;
+		
+		static unsigned long long hash(const string &s, unsigned long long h);
+		void fail(const string &path);
+};
+#endif /* RESULTCACHE_H */
@@ -0,0 +1,387 @@
+/**
+ * \file		acms/RunSorter.cpp
+ * \brief		The methods of the <b>RunSorter</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "RunSorter.h"
+#include "Penknife.h"
+
+#include <algorithm>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "assert.h"
+
+/**
+ * \brief	Compares two records of a buffer by their bytes.
+ */
+struct RecordLess {
+	
+	/** The first record of the buffer. */
+	const unsigned char *base;
+	
+	/** The size of a record. */
+	int bytes;
+	
+	bool operator()(int a, int b) const
+	{
+		return memcmp(base + (size_t) a * bytes, base + (size_t) b * bytes, \
+			bytes) < 0;
+	}
+};
+
+/**
+ * \brief	Compares two records of a buffer by their bytes, in reverse
+ * 			order, so the standard heap functions keep the smallest one on
+ * 			the top.
+ */
+struct RecordGreater {
+	
+	/** The first record of the buffer. */
+	const unsigned char *base;
+	
+	/** The size of a record. */
+	int bytes;
+	
+	bool operator()(int a, int b) const
+	{
+		return memcmp(base + (size_t) a * bytes, base + (size_t) b * bytes, \
+			bytes) > 0;
+	}
+};
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new empty <b>RunSorter</b> element.
+ * 
+ * \fn		RunSorter::RunSorter(const char *dir, int size, long memory)
+ * \param	*dir: the directory of the scratch files. <code>NULL</code> for
+ * 			the one of <code>tmpfile()</code>.
+ * \param	size: the size of a record, in bytes.
+ * \param	memory: the number of bytes of the records kept in memory.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+RunSorter::RunSorter(const char *dir, int size, long memory)
+{
+	Directory = dir;
+	bytes = size;
+	capacity = memory / (size + sizeof(int));
+	count = 0;
+	position = 0;
+	
+	if (capacity < _SORTER_MIN_RECORDS) {
+		
+		capacity = _SORTER_MIN_RECORDS;
+	}
+	
+	Record.assign(bytes, 0);
+}
+
+/**
+ * \brief	Class destructor. Closes (and so removes) the scratch files.
+ * 
+ * \fn		RunSorter::~RunSorter()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+RunSorter::~RunSorter()
+{
+	for (int cont = 0; cont < Runs.size(); cont++) {
+		
+		fclose(Runs[cont]);
+	}
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Gets the number of records added to the sorter.
+ * 
+ * \fn		long RunSorter::size()
+ * \return	The number of records.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+long RunSorter::size()
+{
+	return count;
+}
+
+/**
+ * \brief	Gets the number of runs written to the scratch files.
+ * 
+ * \fn		int RunSorter::getRuns()
+ * \return	The number of runs. Zero if all the records fit in memory.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int RunSorter::getRuns()
+{
+	return Runs.size();
+}
+
+/**
+ * \brief	Adds a record to the sorter.
+ * 
+ * \fn		void RunSorter::add(const unsigned char *rec)
+ * \param	*rec: the record. Its bytes are copied.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void RunSorter::add(const unsigned char *rec)
+{
+	size_t limit = (size_t) capacity * bytes;
+	
+	if (Buffer.size() == limit) {
+		
+		writeRun();
+	} else if (Buffer.size() == Buffer.capacity()) {
+		
+		// grows as usual, but never beyond the memory given to the sorter
+		Buffer.reserve(min(2 * Buffer.size() + 64 * bytes, limit));
+	}
+	
+	Buffer.insert(Buffer.end(), rec, rec + bytes);
+	count++;
+}
+
+/**
+ * \brief	Ends the addition of records and starts giving them back.
+ * 
+ * \fn		void RunSorter::sort()
+ * 
+ * If some run was written, the records still in memory are written as the
+ * last run and the first record of each run is read. Otherwise the records
+ * are just sorted in memory.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void RunSorter::sort()
+{
+	if (Runs.size() == 0) {
+		
+		sortBuffer();
+		position = 0;
+		return;
+	}
+	
+	if (Buffer.size() > 0) {
+		
+		writeRun();
+	}
+	
+	vector<unsigned char>().swap(Buffer);
+	vector<int>().swap(Order);
+	
+	Heads.assign(Runs.size() * bytes, 0);
+	Heap.clear();
+	
+	for (int cont = 0; cont < Runs.size(); cont++) {
+		
+		rewind(Runs[cont]);
+		
+		if (readHead(cont)) {
+			
+			Heap.push_back(cont);
+		}
+	}
+	
+	RecordGreater greater = {&Heads[0], bytes};
+	make_heap(Heap.begin(), Heap.end(), greater);
+}
+
+/**
+ * \brief	Gives back the next record, in order.
+ * 
+ * \fn		const unsigned char * RunSorter::next()
+ * \return	The record, valid until the next call. <code>NULL</code> if all
+ * 			the records were given back.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const unsigned char * RunSorter::next()
+{
+	if (Runs.size() == 0) {
+		
+		if (position == Order.size()) {
+			
+			return NULL;
+		}
+		
+		return &Buffer[(size_t) Order[position++] * bytes];
+	}
+	
+	if (Heap.size() == 0) {
+		
+		return NULL;
+	}
+	
+	RecordGreater greater = {&Heads[0], bytes};
+	int run = Heap.front();
+	
+	pop_heap(Heap.begin(), Heap.end(), greater);
+	Heap.pop_back();
+	
+	memcpy(&Record[0], &Heads[(size_t) run * bytes], bytes);
+	
+	if (readHead(run)) {
+		
+		Heap.push_back(run);
+		push_heap(Heap.begin(), Heap.end(), greater);
+	}
+	
+	return &Record[0];
+}
+
+/**
+ * \brief	Writes an integer in a record.
+ * 
+ * \fn		void RunSorter::putInt(unsigned char *p, int v)
+ * \param	*p: where the 4 bytes of the integer are written.
+ * \param	v: the integer. Must not be negative.
+ * 
+ * The most significant byte is written first, so the order of the bytes is
+ * the order of the integers.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void RunSorter::putInt(unsigned char *p, int v)
+{
+	assert(v >= 0);
+	
+	p[0] = (v >> 24) & 0xff;
+	p[1] = (v >> 16) & 0xff;
+	p[2] = (v >> 8) & 0xff;
+	p[3] = v & 0xff;
+}
+
+/**
+ * \brief	Reads an integer of a record (see <code>putInt()</code>).
+ * 
+ * \fn		int RunSorter::getInt(const unsigned char *p)
+ * \param	*p: the 4 bytes of the integer.
+ * \return	The integer.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int RunSorter::getInt(const unsigned char *p)
+{
+	return (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PRIVATE METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Sorts the records of the buffer.
+ * 
+ * \fn		void RunSorter::sortBuffer()
+ * 
+ * Only their positions are sorted, in <code>Order</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void RunSorter::sortBuffer()
+{
+	int records = Buffer.size() / bytes;
+	
+	Order.resize(records);
+	
+	for (int cont = 0; cont < records; cont++) {
+		
+		Order[cont] = cont;
+	}
+	
+	if (records > 0) {
+		
+		RecordLess less = {&Buffer[0], bytes};
+		std::sort(Order.begin(), Order.end(), less);
+	}
+}
+
+/**
+ * \brief	Writes the records of the buffer as a new run.
+ * 
+ * \fn		void RunSorter::writeRun()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void RunSorter::writeRun()
+{
+	FILE *run = Penknife::pkscratch(Directory);
+	
+	setvbuf(run, NULL, _IOFBF, _SORTER_BUFFER);
+	sortBuffer();
+	
+	for (int cont = 0; cont < Order.size(); cont++) {
+		
+		fwrite(&Buffer[(size_t) Order[cont] * bytes], bytes, 1, run);
+	}
+	
+	if (fflush(run) != 0) {
+		
+		Penknife::pkerrors(_PK_ERROR_SCRATCH, (char *) \
+			(Directory == NULL ? "tmpfile()" : Directory));
+		exit(_PK_ERROR_CODE_SCRATCH);
+	}
+	
+	Runs.push_back(run);
+	Buffer.clear();
+}
+
+/**
+ * \brief	Reads the next record of a run.
+ * 
+ * \fn		bool RunSorter::readHead(int run)
+ * \param	run: the position of the run.
+ * \return	<b>true</b> if there was one more record. It is left in
+ * 			<code>Heads</code>. <b>false</b> if the run is exhausted.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool RunSorter::readHead(int run)
+{
+	return fread(&Heads[(size_t) run * bytes], bytes, 1, Runs[run]) == 1;
+}
@@ -0,0 +1,121 @@
+/**
+ * \file		acms/RunSorter.h
+ * \brief		The definition of the <b>RunSorter</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include <vector>
+
+#include <stdio.h>
+
+#ifndef RUNSORTER_H
+#define RUNSORTER_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFINES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Minimum number of records kept in memory before a run is written. */
+#define _SORTER_MIN_RECORDS					1024
+
+/** Size of the buffer of each file of the sorter. */
+#define _SORTER_BUFFER						(1 << 16)
+
+/**
+ * \class	RunSorter RunSorter.h
+ * \brief	The <b>RunSorter</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>RunSorter</b> class. Sorts a sequence of records of a fixed size
+ * that may not fit in memory. The records are compared byte by byte, as
+ * with <code>memcmp()</code>, so integers must be written most significant
+ * byte first (see <code>putInt()</code>) to be sorted by value.
+ * 
+ * The records are added to a buffer of bounded size. When it is full, it is
+ * sorted and written as a run to a scratch file. Once all the records are
+ * added, <code>sort()</code> and <code>next()</code> merge the runs and give
+ * back the records in order. If all of them fit in the buffer, nothing is
+ * written.
+ */
+class RunSorter {
+	
+	public:
+		
+		RunSorter(const char *dir, int size, long memory);
+		~RunSorter();
+		
+		long size();
+		int getRuns();
+		
+		void add(const unsigned char *rec);
+		void sort();
+		const unsigned char * next();
+		
+		static void putInt(unsigned char *p, int v);
+		static int getInt(const unsigned char *p);
+		
+	private:
+		
+		/** The directory of the scratch files. */
+		const char *Directory;
+		
+		/** The size of a record, in bytes. */
+		int bytes;
+		
+		/** The number of records that fit in <code>Buffer</code>. */
+		long capacity;
+		
+		/** The number of records added. */
+		long count;
+		
+		/** The records that have not been written to a run yet. */
+		vector<unsigned char> Buffer;
+		
+		/** The positions of the records of <code>Buffer</code>, sorted. */
+		vector<int> Order;
+		
+		/** The position in <code>Order</code> of the next record to give
+		 *  back, if there are no runs. */
+		int position;
+		
+		/** The scratch files with the sorted runs. */
+		vector<FILE *> Runs;
+		
+		/** The first record of each run that has not been given back. */
+		vector<unsigned char> Heads;
+		
+		/** The runs that are not exhausted, as a heap by their head. */
+		vector<int> Heap;
+		
+		/** The record given back by <code>next()</code>. */
+		vector<unsigned char> Record;
+		
+		void sortBuffer();
+		void writeRun();
+		bool readHead(int run);
+};
+#endif /* RUNSORTER_H */
@@ -0,0 +1,305 @@
+/**
+ * \file		acms/SharedStore.cpp
+ * \brief		The methods of the <b>SharedStore</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "SharedStore.h"
+
+#include "assert.h"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new empty <b>SharedStore</b> element.
+ * 
+ * \fn		SharedStore::SharedStore()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+SharedStore::SharedStore()
+{}
+
+/**
+ * \brief	Class destructor.
+ * 
+ * \fn		SharedStore::~SharedStore()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+SharedStore::~SharedStore()
+{
+	clear();
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Sets the layout of the states and empties the store.
+ * 
+ * \fn		void SharedStore::setFields(const vector<int> &bits, int threads)
+ * \param	bits: the width in bits of each field of a state (see
+ * 			<code>StateStore::setFields()</code>).
+ * \param	threads: the number of threads that will use the store.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void SharedStore::setFields(const vector<int> &bits, int threads)
+{
+	int cont;
+	int size = threads * _SHARED_SHARDS_PER_THREAD;
+	
+	clear();
+	
+	for (cont = 0; cont < size; cont++) {
+		
+		Shards.push_back(new StateStore());
+		Shards.back()->setFields(bits);
+		
+		Locks.push_back(new mutex());
+	}
+}
+
+/**
+ * \brief	Inserts a state in the store.
+ * 
+ * \fn		int SharedStore::insert(const vector<int> &v, bool &created)
+ * \param	v: the fields of the state.
+ * \param	created: set to <b>true</b> if the state was not in the store.
+ * \return	The handle of the state.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int SharedStore::insert(const vector<int> &v, bool &created)
+{
+	int s = shard(v);
+	int pos;
+	
+	Locks[s]->lock();
+	
+	int before = Shards[s]->size();
+	
+	pos = Shards[s]->insert(v);
+	created = (Shards[s]->size() != before);
+	
+	Locks[s]->unlock();
+	
+	return pos * Shards.size() + s;
+}
+
+/**
+ * \brief	Unpacks a stored state.
+ * 
+ * \fn		void SharedStore::get(int handle, vector<int> &v)
+ * \param	handle: the handle of the state.
+ * \param	v: vector where the fields of the state are written.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void SharedStore::get(int handle, vector<int> &v)
+{
+	int s = handle % Shards.size();
+	
+	Locks[s]->lock();
+	Shards[s]->get(handle / Shards.size(), v);
+	Locks[s]->unlock();
+}
+
+/**
+ * \brief	Gets the number of stored states.
+ * 
+ * \fn		int SharedStore::size()
+ * \return	The number of states in the store.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int SharedStore::size()
+{
+	int cont, total = 0;
+	int size = Shards.size();
+	
+	for (cont = 0; cont < size; cont++) {
+		
+		Locks[cont]->lock();
+		total += Shards[cont]->size();
+		Locks[cont]->unlock();
+	}
+	
+	return total;
+}
+
+/**
+ * \brief	Gets the load factor of the store.
+ * 
+ * \fn		double SharedStore::getLoad()
+ * \return	The average of the load factors of the shards.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+double SharedStore::getLoad()
+{
+	int cont;
+	int size = Shards.size();
+	double total = 0;
+	
+	for (cont = 0; cont < size; cont++) {
+		
+		Locks[cont]->lock();
+		total += Shards[cont]->getLoad();
+		Locks[cont]->unlock();
+	}
+	
+	return size > 0 ? total / size : 0;
+}
+
+/**
+ * \brief	Gets the memory reserved by the store.
+ * 
+ * \fn		long SharedStore::getMemory()
+ * \return	The number of bytes reserved by all the shards.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+long SharedStore::getMemory()
+{
+	int cont;
+	int size = Shards.size();
+	long total = 0;
+	
+	for (cont = 0; cont < size; cont++) {
+		
+		Locks[cont]->lock();
+		total += Shards[cont]->getMemory();
+		Locks[cont]->unlock();
+	}
+	
+	return total;
+}
+
+/**
+ * \brief	Computes the positions of the states in the store.
+ * 
+ * \fn		void SharedStore::makeIndex()
+ * 
+ * Must be called when no more states will be inserted.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void SharedStore::makeIndex()
+{
+	int cont, base = 0;
+	int size = Shards.size();
+	
+	Bases.clear();
+	
+	for (cont = 0; cont < size; cont++) {
+		
+		Bases.push_back(base);
+		base += Shards[cont]->size();
+	}
+}
+
+/**
+ * \brief	Gets the position of a state in the store.
+ * 
+ * \fn		int SharedStore::index(int handle)
+ * \param	handle: the handle of the state.
+ * \return	A number between <i>0</i> and <code>size()</code> - 1, different
+ * 			for each state (see <code>makeIndex()</code>).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int SharedStore::index(int handle)
+{
+	assert(Bases.size() == Shards.size());
+	
+	return Bases[handle % Shards.size()] + handle / Shards.size();
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PRIVATE METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Removes all the shards.
+ * 
+ * \fn		void SharedStore::clear()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void SharedStore::clear()
+{
+	int cont;
+	int size = Shards.size();
+	
+	for (cont = 0; cont < size; cont++) {
+		
+		delete Shards[cont];
+		delete Locks[cont];
+	}
+	
+	Shards.clear();
+	Locks.clear();
+	Bases.clear();
+}
+
+/**
+ * \brief	Chooses the shard of a state.
+ * 
+ * \fn		int SharedStore::shard(const vector<int> &v)
+ * \param	v: the fields of the state.
+ * \return	The shard where the state is (or will be) stored.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int SharedStore::shard(const vector<int> &v)
+{
+	unsigned int h = 2166136261U;
+	int size = v.size();
+	
+	for (int cont = 0; cont < size; cont++) {
+		
+		h ^= (unsigned int)v[cont];
+		h *= 16777619U;
+	}
+	
+	// the low bits are used by the hash table of the shards
+	return (h >> 16) % Shards.size();
+}
@@ -0,0 +1,95 @@
+/**
+ * \file		acms/SharedStore.h
+ * \brief		The definition of the <b>SharedStore</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+using namespace std;
+
+#include "config.h"
+
+#include "StateStore.h"
+
+#include <mutex>
+#include <vector>
+
+#ifndef SHAREDSTORE_H
+#define SHAREDSTORE_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFINES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Number of shards of the store for each thread using it. */
+#define _SHARED_SHARDS_PER_THREAD			16
+
+/**
+ * \class	SharedStore SharedStore.h
+ * \brief	The <b>SharedStore</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>SharedStore</b> class. A set of states that can be used by many
+ * threads at the same time. The states are spread over some
+ * <b>StateStore</b> objects (the shards), each one protected by its own
+ * mutex, so two threads only wait for each other when they touch the same
+ * shard.
+ * 
+ * A state is identified by a handle, which encodes its shard and its position
+ * in the shard. Once all the states have been inserted, <code>index()</code>
+ * maps the handles to the positions <i>0</i>..<code>size()</code> - 1.
+ */
+class SharedStore {
+	
+	public:
+		
+		SharedStore();
+		~SharedStore();
+		
+		void setFields(const vector<int> &bits, int threads);
+		
+		int insert(const vector<int> &v, bool &created);
+		void get(int handle, vector<int> &v);
+		
+		int size();
+		double getLoad();
+		long getMemory();
+		void makeIndex();
+		int index(int handle);
+		
+	private:
+		
+		/** The shards of the store. */
+		vector<StateStore *> Shards;
+		
+		/** The lock of each shard. */
+		vector<mutex *> Locks;
+		
+		/** The position of the first state of each shard (see
+		 *  <code>makeIndex()</code>). */
+		vector<int> Bases;
+		
+		void clear();
+		int shard(const vector<int> &v);
+};
+#endif /* SHAREDSTORE_H */
@@ -38,25 +38,27 @@ using namespace std;
  * \brief	Class constructor. Creates a new <b>Simulator</b> element.
  * 
  * \fn		Simulator::Simulator(char *filename)
- * \param	*filename: the name of the file containing a description of a 
- * 			process in the <b>Petrify</b> language.
+ * \param	*filename: the name of the file containing an <code>ACM</code>
+ * 			in the binary format (see <code>StateGraph::acm2binary()</code>).
  * 
- * Using this constructor, it will necessary to parse the input file and reads
- * its contents to the main memory.
+ * Using this constructor, the file is mapped in memory (see
+ * <b>ACMImage</b>) and the simulation walks the map, so nothing is parsed.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	22/09/2004
  */
 Simulator::Simulator(char *filename)
 {
-	cout << "TODO: need to implement this!" << endl;
+	ACM = NULL;
+	Image = new ACMImage(filename);
 }
 
 /**
  * \brief	Class constructor. Creates a new <b>Simulator</b> element.
  * 
- * \fn		Simulator::Simulator(Process p)
- * \param	p: a process that is in the main memory.
+ * \fn		Simulator::Simulator(Process *p)
+ * \param	*p: a process that is in the main memory. It is not copied, so it
+ * 			must live as long as the simulator.
  * 
  * Using this constructor, the process to be simulated is already in the main
  * memory, and it is not necessary to load it before simulating.
@@ -64,9 +66,10 @@ Simulator::Simulator(char *filename)
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	22/09/2004
  */
-Simulator::Simulator(Process p)
+Simulator::Simulator(Process *p)
 {
-	ACM = &p;
+	ACM = p;
+	Image = NULL;
 }
 
 /**
@@ -78,7 +81,9 @@ Simulator::Simulator(Process p)
  * \date	22/09/2004
  */
 Simulator::~Simulator()
-{}
+{
+	delete Image;
+}
 
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * PUBLIC METHODS
@@ -99,6 +104,30 @@ void Simulator::Sim(int n)
 	int succ;
 	vector<int> vsucc;
 	
+	if (Image != NULL) {
+		
+		state = Image->getInit();
+		
+		for (int cont = 0; cont < n; cont++) {
+			
+			int first = Image->getFirstArc(state);
+			int arcs = Image->getLastArc(state) - first;
+			
+			if (arcs == 0) {
+				
+				break;
+			}
+			
+			succ = first + int(arcs * (rand() / (RAND_MAX + 1.0)));
+			
+			cout << Image->getEventLabel(Image->getEvent(succ)) << endl;
+			
+			state = Image->getDest(succ);
+		}
+		
+		return;
+	}
+	
 	for (int cont = 0; cont < n; cont++) {
 		
 		vsucc.clear();
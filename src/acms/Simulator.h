@@ -27,6 +27,7 @@ using namespace std;
 
 #include "config.h"
 
+#include "ACMImage.h"
 #include "Process.h"
 
 #ifndef SIMULATOR_H
@@ -52,12 +53,16 @@ class Simulator {
 		/** The process that will be simulated. */
 		Process *ACM;
 		
+		/** The binary <code>ACM</code> that will be simulated, if it was
+		 *  loaded from a file. <code>NULL</code> otherwise. */
+		ACMImage *Image;
+		
 		/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 		 * Public methods prototypes.
 		 * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
 		 
 		Simulator(char *filename);
-		Simulator(Process p);
+		Simulator(Process *p);
 		~Simulator();
 		
 		void Sim(int n);
@@ -30,6 +30,9 @@ using namespace std;
 
 #include <iostream>
 #include <sstream>
+#include <thread>
+
+#include <string.h>
 
 #include "assert.h"
 
@@ -52,13 +55,58 @@ StateGraph::StateGraph(Channel *ch, vector<Process *> proc)
 	Process *aux = new Process(_ACMS_PROCESS_LABEL);
 	ACM = aux;
 	
-	ACMChannel = ch;
+	setChannel(ch);
 	Processes = proc;
 	
-	isRRBB = false;
+	Threads = _ACMS_THREADS;
+	Symmetry = _ACMS_SYMMETRY_NONE;
+	Reduction = false;
+	External = false;
+	ExternalDir = NULL;
+	ExternalMemory = _ACMS_EXTERNAL_MEMORY;
+	Writer = NULL;
+	Net = NULL;
+	Stats = NULL;
+	SuccessorAllocations = 0;
+	ParallelLoad = 0;
+	ParallelMemory = 0;
 }
 
 
+/**
+ * \brief	Class constructor. Creates a new StateGraph element.
+ * 
+ * \fn		StateGraph::StateGraph(vector<Channel *> ch,
+ * 											vector<Process *> proc)
+ * \param	ch: the channels of the system. The channel of an IO arc of the
+ * 			processes is its position in <i>ch</i>.
+ * \param	proc: vector containg all the processes of the system.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+StateGraph::StateGraph(vector<Channel *> ch, vector<Process *> proc)
+{
+	Process *aux = new Process(_ACMS_PROCESS_LABEL);
+	ACM = aux;
+	
+	setChannels(ch);
+	Processes = proc;
+	
+	Threads = _ACMS_THREADS;
+	Symmetry = _ACMS_SYMMETRY_NONE;
+	Reduction = false;
+	External = false;
+	ExternalDir = NULL;
+	ExternalMemory = _ACMS_EXTERNAL_MEMORY;
+	Writer = NULL;
+	Net = NULL;
+	Stats = NULL;
+	SuccessorAllocations = 0;
+	ParallelLoad = 0;
+	ParallelMemory = 0;
+}
+
 /**
  * \brief	Class constructor. Creates a new StateGraph element.
  * 
@@ -86,21 +134,32 @@ StateGraph::StateGraph(int policy, int size)
 		ch->setSlots(2);
 	}
 	
-	ACMChannel = ch;
+	setChannel(ch);
 	
 	Process *p1 = new Process("writer");
 	p1->insertState("s0");
 	p1->insertArc(p1->States.back()->getTarget(), "wrCH", 
-		p1->States.back()->getTarget(), _ARC_WRITE, ch->getTarget());
+		p1->States.back()->getTarget(), _ARC_WRITE, 0);
 	
 	Process *p2 = new Process("reader");
 	p2->insertState("s0");
-	p2->insertArc(0, "rdCH", 0, _ARC_READ, ch->getTarget());
+	p2->insertArc(0, "rdCH", 0, _ARC_READ, 0);
 	
 	Processes.insert(Processes.end(), p1);
 	Processes.insert(Processes.end(), p2);
 	
-	isRRBB = false;
+	Threads = _ACMS_THREADS;
+	Symmetry = _ACMS_SYMMETRY_NONE;
+	Reduction = false;
+	External = false;
+	ExternalDir = NULL;
+	ExternalMemory = _ACMS_EXTERNAL_MEMORY;
+	Writer = NULL;
+	Net = NULL;
+	Stats = NULL;
+	SuccessorAllocations = 0;
+	ParallelLoad = 0;
+	ParallelMemory = 0;
 }
 
 /**
@@ -116,7 +175,19 @@ StateGraph::StateGraph()
 	Process *aux = new Process(_ACMS_PROCESS_LABEL);
 	ACM = aux;
 	
-	isRRBB = false;
+	ACMChannel = NULL;
+	Threads = _ACMS_THREADS;
+	Symmetry = _ACMS_SYMMETRY_NONE;
+	Reduction = false;
+	External = false;
+	ExternalDir = NULL;
+	ExternalMemory = _ACMS_EXTERNAL_MEMORY;
+	Writer = NULL;
+	Net = NULL;
+	Stats = NULL;
+	SuccessorAllocations = 0;
+	ParallelLoad = 0;
+	ParallelMemory = 0;
 }
 
 /**
@@ -130,6 +201,10 @@ StateGraph::StateGraph()
 StateGraph::~StateGraph()
 {
 	reset();
+	
+	delete Writer;
+	delete Stats;
+	delete ACM;
 }
 
 
@@ -140,15 +215,16 @@ StateGraph::~StateGraph()
 /**
  * \brief	Gets the synthesized process (ACM).
  * 
- * \fn		Process StateGraph::getACM()
- * \return	The synthesized ACM.
+ * \fn		Process * StateGraph::getACM()
+ * \return	The synthesized ACM. It belongs to the state graph and is freed
+ * 			with it.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	17/06/2004
  */
-Process StateGraph::getACM()
+Process * StateGraph::getACM()
 {
-	return *ACM;
+	return ACM;
 }
 
 /**
@@ -179,11 +255,26 @@ vector<Process *> StateGraph::getProcesses()
 	return Processes;
 }
 
+/**
+ * \brief	Gets the channels of the system.
+ * 
+ * \fn		vector<Channel *> StateGraph::getChannels()
+ * \return	The channels of the system.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+vector<Channel *> StateGraph::getChannels()
+{
+	return Channels;
+}
+
 /**
  * \brief	Sets the channel of the system.
  * 
  * \fn		void StateGraph::setChannel(Channel *ch)
- * \param	ch: the channel of the system.
+ * \param	ch: the channel of the system. The IO arcs of the processes must
+ * 			be on the channel 0.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	14/06/2004
@@ -191,6 +282,23 @@ vector<Process *> StateGraph::getProcesses()
 void StateGraph::setChannel(Channel *ch)
 {
 	ACMChannel = ch;
+	Channels.assign(1, ch);
+}
+
+/**
+ * \brief	Sets the channels of the system.
+ * 
+ * \fn		void StateGraph::setChannels(vector<Channel *> ch)
+ * \param	ch: the channels of the system. The channel of an IO arc of the
+ * 			processes is its position in <i>ch</i>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::setChannels(vector<Channel *> ch)
+{
+	Channels = ch;
+	ACMChannel = ch.size() > 0 ? ch[0] : NULL;
 }
 
 /**
@@ -207,6 +315,283 @@ void StateGraph::setProcesses(vector<Process *> proc)
 	Processes = proc;
 }
 
+/**
+ * \brief	Gets the number of threads used to generate the state space.
+ * 
+ * \fn		int StateGraph::getThreads()
+ * \return	The number of threads.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateGraph::getThreads()
+{
+	return Threads;
+}
+
+/**
+ * \brief	Sets the number of threads used to generate the state space.
+ * 
+ * \fn		void StateGraph::setThreads(int n)
+ * \param	n: the number of threads. With more than one thread the state
+ * 			space is generated by <code>generateStateSpaceParallel()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::setThreads(int n)
+{
+	Threads = n < 1 ? 1 : n;
+}
+
+/**
+ * \brief	Checks if the state graph is streamed while it is generated.
+ * 
+ * \fn		bool StateGraph::getStream()
+ * \return	<b>true</b> if the state graph is streamed. <b>false</b>
+ * 			otherwise.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool StateGraph::getStream()
+{
+	return Writer != NULL;
+}
+
+/**
+ * \brief	Sets if the state graph is streamed while it is generated.
+ * 
+ * \fn		void StateGraph::setStream(bool s)
+ * \param	s: <b>true</b> to stream the state graph.
+ * 
+ * When the state graph is streamed, <code>makeACM()</code> does not keep the
+ * states and arcs in the process <code>ACM</code>: the arcs are written by a
+ * <b>PetrifyWriter</b> as soon as they are found, and
+ * <code>acm2petrify()</code> just copies what the writer wrote. So only
+ * the visited states are kept in memory. The output is the same in both
+ * cases, but <code>ACM</code> stays empty and cannot be used for anything
+ * else (e.g. <code>acm2petrinet()</code>).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::setStream(bool s)
+{
+	if (s == true && Writer == NULL) {
+		
+		Writer = new PetrifyWriter();
+	} else if (s == false && Writer != NULL) {
+		
+		delete Writer;
+		Writer = NULL;
+	}
+}
+
+/**
+ * \brief	Sets if the progress of the generation is reported.
+ * 
+ * \fn		void StateGraph::setStats(const char *file)
+ * \param	*file: the file where the progress is written. If it is
+ * 			<code>NULL</code>, it is written to the standard error.
+ * 
+ * While the state space is explored, a line with the states, the frontier,
+ * the arcs, the rate and the memory is written every
+ * <code>_STATS_INTERVAL</code> seconds. <code>acm2petrify()</code> ends
+ * with a summary of the time spent in each phase.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::setStats(const char *file)
+{
+	delete Stats;
+	Stats = new ExplorationStats(file);
+}
+
+/**
+ * \brief	Gets the symmetry reduction used to generate the state space.
+ * 
+ * \fn		int StateGraph::getSymmetry()
+ * \return	<code>_ACMS_SYMMETRY_NONE</code>,
+ * 			<code>_ACMS_SYMMETRY_QUOTIENT</code> or
+ * 			<code>_ACMS_SYMMETRY_EXPAND</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateGraph::getSymmetry()
+{
+	return Symmetry;
+}
+
+/**
+ * \brief	Sets the symmetry reduction used to generate the state space.
+ * 
+ * \fn		void StateGraph::setSymmetry(int s)
+ * \param	s: <code>_ACMS_SYMMETRY_NONE</code>,
+ * 			<code>_ACMS_SYMMETRY_QUOTIENT</code> or
+ * 			<code>_ACMS_SYMMETRY_EXPAND</code>.
+ * 
+ * The cells of the channel are a ring: the counters only move forward
+ * modulo the number of cells and only compare cells for equality. So two
+ * states that differ by a rotation of the cells have the same successors,
+ * rotated too. With symmetry reduction only the representative of each
+ * orbit (the state where the writer is in the cell 0) is stored and
+ * expanded (see <code>generateStateSpaceSymmetric()</code>), which divides
+ * the number of visited states by the number of cells.
+ * 
+ * With <code>_ACMS_SYMMETRY_QUOTIENT</code> the <code>ACM</code> is the
+ * quotient graph, whose arcs are labelled as seen from their source. With
+ * <code>_ACMS_SYMMETRY_EXPAND</code> the quotient is expanded back (see
+ * <code>expandQuotient()</code>) and the <code>ACM</code> is the same one
+ * generated without reduction. The reduced generation is always done by
+ * only one thread.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::setSymmetry(int s)
+{
+	Symmetry = s;
+}
+
+/**
+ * \brief	Gets if the partial order reduction is used to generate the state
+ * 			space.
+ * 
+ * \fn		bool StateGraph::getReduction()
+ * \return	<b>true</b> if it is used. <b>false</b> otherwise.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool StateGraph::getReduction()
+{
+	return Reduction;
+}
+
+/**
+ * \brief	Sets if the partial order reduction is used to generate the state
+ * 			space.
+ * 
+ * \fn		void StateGraph::setReduction(bool r)
+ * \param	r: <b>true</b> to use it. <b>false</b> otherwise.
+ * 
+ * The local arcs (<code>_ARC_NONE</code>) of a process only change the
+ * state of that process, so they commute with the arcs of all the other
+ * processes. With the reduction, a state where all the arcs leaving the
+ * state of some process are local is expanded only by those arcs (see
+ * <code>ampleSet()</code>): the other interleavings are reached later in
+ * the same order. The reduced <code>ACM</code> keeps the deadlocks and the
+ * order of the accesses to the channels, but not all the states. It is
+ * only used by the sequential generation without symmetry reduction.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::setReduction(bool r)
+{
+	Reduction = r;
+}
+
+/**
+ * \brief	Gets if the state space is generated in external memory.
+ * 
+ * \fn		bool StateGraph::getExternal()
+ * \return	<b>true</b> if it is. <b>false</b> otherwise.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool StateGraph::getExternal()
+{
+	return External;
+}
+
+/**
+ * \brief	Generates the state space in external memory.
+ * 
+ * \fn		void StateGraph::setExternal(const char *dir, long memory)
+ * \param	*dir: the directory of the scratch files. <code>NULL</code> for
+ * 			the one of <code>tmpfile()</code>.
+ * \param	memory: the number of bytes of memory to use, more or less.
+ * 
+ * The visited states, the frontier and the arcs are kept in scratch files of
+ * <i>dir</i>, so the size of the state space is not bounded by the memory
+ * (see <code>generateStateSpaceExternal()</code>). The state graph is
+ * streamed (see <code>setStream()</code>) to a file of <i>dir</i> too. The
+ * output is the same one of the generation in memory. The threads, the
+ * symmetry and the partial order reduction are not used.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::setExternal(const char *dir, long memory)
+{
+	External = true;
+	ExternalDir = dir;
+	ExternalMemory = memory;
+	
+	setStream(true);
+	Writer->setDirectory(dir);
+}
+
+/**
+ * \brief	Gets the number of allocations done while generating successors.
+ * 
+ * \fn		long StateGraph::getSuccessorAllocations()
+ * \return	The number of times memory was allocated inside
+ * 			<code>nextSuccessor()</code> during the last
+ * 			<code>makeACM()</code>, by all threads. It should be zero: the
+ * 			successors are built in buffers reserved beforehand.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+long StateGraph::getSuccessorAllocations()
+{
+	return SuccessorAllocations;
+}
+
+/**
+ * \brief	Gets the number of states of the generated state graph.
+ * 
+ * \fn		int StateGraph::getStates()
+ * \return	The number of states, also when the state graph is streamed.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateGraph::getStates()
+{
+	if (Writer != NULL) {
+		
+		return Writer->getStates();
+	}
+	
+	return ACM->States.size();
+}
+
+/**
+ * \brief	Gets the number of arcs of the generated state graph.
+ * 
+ * \fn		int StateGraph::getArcs()
+ * \return	The number of arcs, also when the state graph is streamed.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateGraph::getArcs()
+{
+	if (Writer != NULL) {
+		
+		return Writer->getArcs();
+	}
+	
+	return ACM->Arcs.size();
+}
+
 /**
  * \brief	This is the public method to generate the ACM process.
  * 
@@ -225,6 +610,8 @@ void StateGraph::makeACM()
 	generateStateSpace();
 	
 	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " successor allocations: "
+			 << SuccessorAllocations << endl;
 		cerr << __FILE__ << ": " << __LINE__ << " /makeACM()" << endl;
 	#endif
 }
@@ -247,10 +634,19 @@ void StateGraph::reset()
 	vector<int> aux;
 	
 	New.clear();
-	All.clear();
-	Counters.clear();
-	LastCounters.clear();
-	_counters.clear();
+	Store.clear();
+	Quotient.clear();
+	QuotientFirst.clear();
+	Scratch.counters.clear();
+	SuccessorAllocations = 0;
+	ParallelLoad = 0;
+	ParallelMemory = 0;
+	Events.setProcesses(Processes);
+	
+	if (Writer != NULL) {
+		
+		Writer->open();
+	}
 	
 	#ifdef _JABUTI_ACMS_DEBBUGING
 		cerr << __FILE__ << ": " << __LINE__ << " /reset()" << endl;
@@ -275,12 +671,49 @@ void StateGraph::generateStateSpace()
 		cerr << __FILE__ << ": " << __LINE__ << " generateStateSpace()" << endl;
 	#endif
 	
-	createInitState();
-	
-	while (New.size() != 0) {
+	if (External) {
 		
-		generateSuccessors(New.back());
-		New.pop_back();
+		generateStateSpaceExternal();
+	} else if (Symmetry != _ACMS_SYMMETRY_NONE) {
+		
+		generateStateSpaceSymmetric();
+	} else if (Threads > 1) {
+		
+		generateStateSpaceParallel();
+	} else {
+		
+		if (Stats != NULL) {
+			
+			Stats->begin("init");
+		}
+		
+		createInitState();
+		reserveScratch(&Scratch);
+		
+		if (Stats != NULL) {
+			
+			Stats->end();
+			Stats->begin("exploration");
+		}
+		
+		while (New.size() != 0) {
+			
+			generateSuccessors(New.back());
+			New.pop_back();
+			
+			if (Stats != NULL && Stats->due()) {
+				
+				Stats->report(Store.size(), New.size(), getArcs(), \
+					Store.getLoad(), Store.getMemory());
+			}
+		}
+		
+		if (Stats != NULL) {
+			
+			Stats->end();
+		}
+		
+		SuccessorAllocations = Scratch.allocations;
 	}
 	
 	#ifdef _JABUTI_ACMS_DEBBUGING
@@ -289,1171 +722,3042 @@ void StateGraph::generateStateSpace()
 }
 
 /**
- * \brief	Creates the initial state of the <code>ACM</code> process.
- * 
- * \fn		void StateGraph::createInitState()
- * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	31/01/2006
+ * \brief	Generates the state space of the <code>ACM</code> process using
+ * 			<code>Threads</code> threads.
+ * 
+ * \fn		void StateGraph::generateStateSpaceParallel()
+ * 
+ * The work is done in two phases:
+ * 	-#	the threads explore the reachable states (see
+ * 		<code>exploreThread()</code>), sharing a <b>SharedStore</b> with the
+ * 		visited states and a <b>WorkPool</b> with the states to expand. Each
+ * 		thread records the arcs leaving the states it expanded;
+ * 	-#	the recorded graph is walked breadth first from the initial state,
+ * 		in the same order used by <code>generateStateSpace()</code>, to
+ * 		number the states and create the states and arcs of the
+ * 		<code>ACM</code>.
+ * 
+ * So the result does not depend on the scheduling of the threads and is the
+ * same obtained with only one thread. The records hold the whole graph
+ * until the walk, which is no worse than the <code>ACM</code> kept in
+ * memory. When the state graph is streamed the threads record nothing, and
+ * the walk generates the successors again (see
+ * <code>replaySuccessors()</code>), so only the visited states are kept.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-void StateGraph::createInitState()
+void StateGraph::generateStateSpaceParallel()
 {
 	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " createInitState()" << endl;
+		cerr << __FILE__ << ": " << __LINE__ << " generateStateSpaceParallel()"
+			 << endl;
 	#endif
 	
-	vector<int> state;
-	vector<int> aux_c, aux_l;
+	int cont, k, init, total;
+	bool created;
+	vector<int> fields;
 	
-	ostringstream saux;
-	string label;
+	SharedStore shared;
+	WorkPool pool(Threads);
+	vector<ExplorationThread> data(Threads);
+	vector<thread *> workers;
+	
+	if (Stats != NULL) {
+		
+		Stats->begin("init");
+	}
 	
-	saux << ACM->States.size() << flush;
-	label = saux.str();
+	setStateLayout();
+	shared.setFields(Layout, Threads);
 	
-	int size = Processes.size();
-	for (int cont = 0; cont < size; cont++) {
+	initState(fields);
+	init = shared.insert(fields, created);
+	pool.push(0, init);
+	ParallelArcs = 0;
+	
+	if (Stats != NULL) {
 		
-		state.insert(state.end(), _ACMS_INIT);
+		Stats->end();
+		Stats->begin("exploration");
 	}
 	
-	aux_c.clear();
-	aux_l.clear();
+	for (cont = 0; cont < Threads; cont++) {
+		
+		workers.push_back(new thread(&StateGraph::exploreThread, this, cont, \
+			&pool, &shared, &data[cont]));
+	}
 	
-	int n = ACMChannel->getCells();
-	switch (ACMChannel->getType()) {
+	for (cont = 0; cont < Threads; cont++) {
 		
-		case _CHANNEL_RRBB: // message ==> rr-bb
+		workers[cont]->join();
+		delete workers[cont];
+		
+		SuccessorAllocations += data[cont].allocations;
+	}
+	
+	if (Stats != NULL) {
+		
+		Stats->end();
+		Stats->begin("replay");
+	}
+	
+	shared.makeIndex();
+	
+	if (Writer != NULL) {
+		
+		replaySuccessors(&shared, init);
+		ParallelLoad = shared.getLoad();
+		ParallelMemory = shared.getMemory();
+		
+		if (Stats != NULL) {
+			
+			Stats->end();
+		}
+		
+		return;
+	}
+	
+	total = shared.size();
+	
+	vector<int> handles(total), owner(total), first(total), count(total);
+	vector<int> number(total, _ACMS_NONE);
+	vector<int> order;
+	
+	for (cont = 0; cont < Threads; cont++) {
+		
+		vector<int> &expanded = data[cont].Expanded;
+		
+		for (k = 0; k < expanded.size(); k += 3) {
 			
-			aux_c.insert(aux_c.end(), n - 1); // w = n - 1
-			aux_c.insert(aux_c.end(), 0); // r = 0
-			aux_c.insert(aux_c.end(), _ACMS_STEP_1); // write in step 0
-			aux_c.insert(aux_c.end(), _ACMS_STEP_1); // read in step 0
+			int pos = shared.index(expanded[k]);
 			
-			break;
+			handles[pos] = expanded[k];
+			owner[pos] = cont;
+			first[pos] = expanded[k + 1];
+			count[pos] = expanded[k + 2];
+		}
+	}
+	
+	init = shared.index(init);
+	order.push_back(init);
+	
+	number[init] = newState();
+	
+	for (k = 0; k < order.size(); k++) {
+		
+		int src = order[k];
+		vector<int> &arcs = data[owner[src]].Arcs;
+		
+		shared.get(handles[src], Scratch.state);
+		Store.insert(Scratch.state);
+		
+		for (cont = first[src]; cont < first[src] + 3 * count[src]; cont += 3) {
 			
-		case _CHANNEL_OWBB:   // signal ==> ow-bb
-		case _CHANNEL_OWRRBB: // pool ==> ow-rr-bb
+			int dest = shared.index(arcs[cont + 2]);
+			Arc *a = Processes[arcs[cont]]->Arcs[arcs[cont + 1]];
 			
-			aux_c.insert(aux_c.end(), 0); // w = 0
-			aux_c.insert(aux_c.end(), n - 1); // r = 1
-			aux_c.insert(aux_c.end(), _ACMS_STEP_1); // write in step 0
-			aux_c.insert(aux_c.end(), _ACMS_STEP_1); // read in step 0
-			aux_c.insert(aux_c.end(), 1); // slot de w = 1
-			aux_c.insert(aux_c.end(), 1); // slot de r = 1
-			aux_c.insert(aux_c.end(), 0); // overwrite = no
+			if (dest == src) {
+				
+				continue;
+			}
 			
-			break;
+			if (a->isIO()) {
+				
+				shared.get(handles[dest], fields);
+				splitChannel(Scratch.state, a->getChannel(), Scratch.current, \
+					Scratch.currentlast);
+				splitChannel(fields, a->getChannel(), Scratch.counters, \
+					Scratch.lastcounters);
+			}
 			
-		default:
+			if (number[dest] == _ACMS_NONE) {
+				
+				number[dest] = newState();
+				order.push_back(dest);
+			}
 			
-			Penknife::pkerrors(_ACMS_ERROR_POL_N_IMPLEMENTED, "UNKNOWN");
-			exit(_ACMS_ERROR_CODE_POL_N_IMPLEMENTED);
+			createNewArc(arcs[cont], arcs[cont + 1], number[src], \
+				number[dest]);
+		}
 	}
 	
-	All.insert(All.begin(), state);
-	New.insert(New.begin(), _ACMS_INIT);
-	Counters.insert(Counters.begin(), aux_c);
-	LastCounters.insert(LastCounters.begin(), aux_l);
-	
-	ACM->insertState(label.c_str());
+	if (Stats != NULL) {
+		
+		Stats->end();
+	}
 	
 	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /createInitState()" << endl;
+		cerr << __FILE__ << ": " << __LINE__ << " /generateStateSpaceParallel()"
+			 << endl;
 	#endif
 }
 
 /**
- * \brief	Generates all successors of a given state.
- * 
- * \fn		void StateGraph::generateSuccessors(int state)
- * \param	state: the state to generate the successors.
- * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	21/09/2004
+ * \brief	Numbers the states found by the threads and creates the states and
+ * 			arcs of the <code>ACM</code>, generating the successors again.
+ * 
+ * \fn		void StateGraph::replaySuccessors(SharedStore *shared, int init)
+ * \param	*shared: the states found by the threads, indexed.
+ * \param	init: the handle of the initial state.
+ * 
+ * The states are walked breadth first, as in
+ * <code>generateStateSpaceParallel()</code>, but the arcs leaving each one
+ * are generated by <code>nextSuccessor()</code> in the same order the
+ * threads found them, and their targets are looked up in <i>*shared</i>. It
+ * costs a second generation of the successors, but nothing but the visited
+ * states is kept, and they are not copied to <code>Store</code>: it is used
+ * when the state graph is streamed.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-void StateGraph::generateSuccessors(int state)
+void StateGraph::replaySuccessors(SharedStore *shared, int init)
 {
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " generateSuccessors()" << endl;
-	#endif
+	int k, src, succ, dest;
+	bool created;
+	vector<int> number(shared->size(), _ACMS_NONE);
+	vector<int> order;
 	
-	int pcont, psize, scont, ssize, acont, ssucc;
-	vector<int> succ, proc_succ;
+	reserveScratch(&Scratch);
 	
-	psize = Processes.size();
+	order.push_back(init);
+	number[shared->index(init)] = newState();
 	
-	for (pcont = 0; pcont < psize; pcont++) {
+	for (k = 0; k < order.size(); k++) {
 		
-		assert(All.size() == Counters.size());
+		src = shared->index(order[k]);
 		
-		proc_succ = Processes[pcont]->getSuccessors(All[state][pcont]);
-		ssize = proc_succ.size();
+		shared->get(order[k], Scratch.state);
 		
-		for (int scont = 0; scont < ssize; scont++) {
-			
-			acont = Processes[pcont]->getTarget(All[state][pcont], \
-				proc_succ[scont]);
-			
-			succ = All[state];
-			succ[pcont] = nextState(state, pcont, scont, acont, \
-				proc_succ[scont]);
+		firstSuccessor(&Scratch);
+		
+		while (nextSuccessor(&Scratch)) {
 			
-			nextCounters(pcont, acont, state);
-			ssucc = exists(succ);
+			// all the states are there: this only finds the handle
+			succ = shared->insert(Scratch.fields, created);
+			dest = shared->index(succ);
 			
-			if (ssucc == _ACMS_NONE) {
+			if (dest == src) {
 				
-				createNewState(pcont, acont, state, succ);
-			} else if (ssucc != state) { // exists(...) != _ACMS_NONE != state
+				continue;
+			}
+			
+			if (number[dest] == _ACMS_NONE) {
 				
-				createNewArc(pcont, acont, state, ssucc);
+				number[dest] = newState();
+				order.push_back(succ);
 			}
+			
+			createNewArc(Scratch.proc, Scratch.arc, number[src], \
+				number[dest]);
 		}
 	}
 	
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /generateSuccessors()" << endl;
-	#endif
+	SuccessorAllocations += Scratch.allocations;
 }
 
 /**
- * \brief	Creates a new state and adds it to the state space.
+ * \brief	Generates the state space of the <code>ACM</code> process up to
+ * 			the rotation of the cells.
  * 
- * \fn		void StateGraph::createNewState(int proc, int arc, int state,
-															vector<int> succ)
- * \param	proc: the target of the running process.
- * \param	arc: the target of the arc (step) of <i>proc</i> that will be
- * 			executed.
- * \param	state: the target of the current state.
- * \param	succ: the state that is reached when running the process
- * 			<i>proc</i> one step.
+ * \fn		void StateGraph::generateStateSpaceSymmetric()
  * 
- * Creates a new state and adds it to the state space. This method calls the 
- * proper method to create a state (depending on the type of the channel) or
- * simple creates the state if the event is internal do the process.
+ * Works as <code>generateStateSpace()</code>, but each successor is rotated
+ * to its representative (see <code>canonicalRotation()</code>) before it is
+ * looked up in the <code>Store</code>. The cells of each channel are
+ * rotated on their own. The representatives have the writer of every
+ * channel in the cell 0 and an arc changes only the counters of its
+ * channel, so only that channel has to be rotated.
  * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	21/09/2004
+ * The arcs whose successor is the state itself without rotation are
+ * skipped, as usual; the ones whose successor is a rotation of the state
+ * are kept.
+ * 
+ * If the quotient graph is the result, its states and arcs are created
+ * while it is explored. Otherwise its arcs are only recorded in
+ * <code>Quotient</code> and the <code>ACM</code> is built later by
+ * <code>expandQuotient()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-void StateGraph::createNewState(int proc, int arc, int state, vector<int> succ)
+void StateGraph::generateStateSpaceSymmetric()
 {
 	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " createNewState()" << endl;
+		cerr << __FILE__ << ": " << __LINE__ << " generateStateSpaceSymmetric()"
+			 << endl;
 	#endif
 	
-	if (Processes[proc]->Arcs[arc]->isIO()) {
+	int src, dest, rot, states, ch;
+	long arcs = 0;
+	
+	if (Stats != NULL) {
+		
+		Stats->begin("init");
+	}
+	
+	setStateLayout();
+	initState(Scratch.fields);
+	
+	for (ch = 0; ch < Channels.size(); ch++) {
+		
+		rotateChannel(Scratch.fields, ch, \
+			canonicalRotation(Scratch.fields, ch));
+	}
+	
+	Store.insert(Scratch.fields);
+	
+	if (Symmetry == _ACMS_SYMMETRY_QUOTIENT) {
+		
+		newState();
+	}
+	
+	New.push_front(0);
+	reserveScratch(&Scratch);
+	
+	if (Stats != NULL) {
+		
+		Stats->end();
+		Stats->begin("exploration");
+	}
+	
+	while (New.size() != 0) {
+		
+		src = New.back();
+		New.pop_back();
+		
+		decodeState(src);
+		firstSuccessor(&Scratch);
+		QuotientFirst.push_back(Quotient.size());
 		
-		switch (ACMChannel->getType()) {
+		while (nextSuccessor(&Scratch)) {
 			
-			case _CHANNEL_RRBB:
+			Arc *a = Processes[Scratch.proc]->Arcs[Scratch.arc];
+			
+			rot = 0;
+			
+			if (a->isIO()) {
 				
-				createNewStateRR(proc, arc, state, succ);
-				break;
+				rot = canonicalRotation(Scratch.fields, a->getChannel());
+				rotateChannel(Scratch.fields, a->getChannel(), rot);
+			}
 			
-			case _CHANNEL_OWBB:
-			case _CHANNEL_OWRRBB:
+			states = Store.size();
+			dest = Store.insert(Scratch.fields);
+			
+			if (Store.size() > states) {
 				
-				createNewStateOW(proc, arc, state, succ);
-				break;
+				New.push_front(dest);
+				
+				if (Symmetry == _ACMS_SYMMETRY_QUOTIENT) {
+					
+					newState();
+				}
+			}
 			
-			default:
+			if (dest == src && rot == 0) {
 				
-				Penknife::pkerrors(_ACMS_ERROR_POL_N_IMPLEMENTED, "UNKNOWN");
-				exit(_ACMS_ERROR_CODE_POL_N_IMPLEMENTED);
+				continue;
+			}
+			
+			arcs++;
+			
+			if (Symmetry == _ACMS_SYMMETRY_QUOTIENT) {
+				
+				createNewArc(Scratch.proc, Scratch.arc, src, dest);
+			} else {
+				
+				Quotient.push_back(Scratch.proc);
+				Quotient.push_back(Scratch.arc);
+				Quotient.push_back(dest);
+				Quotient.push_back(rot);
+			}
 		}
-	} else {
 		
-		ostringstream saux;
-		string label;
+		if (Stats != NULL && Stats->due()) {
+			
+			Stats->report(Store.size(), New.size(), arcs, Store.getLoad(), \
+				Store.getMemory());
+		}
+	}
+	
+	SuccessorAllocations = Scratch.allocations;
+	
+	if (Stats != NULL) {
 		
-		saux << ACM->States.size() << flush;
-		label = saux.str();
+		Stats->end();
+	}
+	
+	if (Symmetry == _ACMS_SYMMETRY_EXPAND) {
 		
-		ACM->insertState(label.c_str());
-		All.insert(All.end(), succ);
-		New.insert(New.begin(), ACM->getTarget(label.c_str()));
+		if (Stats != NULL) {
+			
+			Stats->begin("expansion");
+		}
 		
-		insertArc(proc, state, ACM->getTarget(label.c_str()), \
-			Processes[proc]->Arcs[arc]->getLabel());
+		expandQuotient();
 		
-		Counters.insert(Counters.end(), _counters);
-		LastCounters.insert(LastCounters.end(), _lastcounters);
+		if (Stats != NULL) {
+			
+			Stats->end();
+		}
 	}
 	
 	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /createNewState()" << endl;
+		cerr << __FILE__ << ": " << __LINE__ << " /generateStateSpaceSymmetric()"
+			 << endl;
 	#endif
 }
 
 /**
- * \brief	Creates a new state and adds it to the state space.
- * 
- * \fn		void StateGraph::createNewStateOW(int proc, int arc, int state, 
-															vector<int> succ)
- * \param	proc: the target of the running process.
- * \param	arc: the target of the arc (step) of <i>proc</i> that will be
- * 			executed.
- * \param	state: the target of the current state.
- * \param	succ: the state that is reached when running the process
- * 			<i>proc</i> one step.
- * 
- * Creates a new state and adds it to the state space. This method is used only
- * in the case that the channel is of type <code>_CHANNEL_OWBB</code> or 
- * <code>_CHANNEL_OWRRBB</code>.
- * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	20/09/2004
+ * \brief	Generates the state space of the <code>ACM</code> process in
+ * 			external memory.
+ * 
+ * \fn		void StateGraph::generateStateSpaceExternal()
+ * 
+ * The states are explored breadth first, one layer (the states at the same
+ * distance from the initial one) at a time, with delayed duplicate
+ * detection. Only the following is kept in memory: the buffers of the
+ * <b>RunSorter</b>s and up to <code>_ACMS_EXTERNAL_CACHE</code> recent
+ * states in <code>Recent</code>. The rest lives in scratch files:
+ * 	-#	the frontier: the packed states of the layer, by number;
+ * 	-#	the visited states: records (packed state, number), sorted by the
+ * 		packed state.
+ * 
+ * Each layer is expanded by <code>expandLayer()</code> and the successors
+ * are looked up in the visited states, and the new ones numbered, by
+ * <code>numberLayer()</code>. Then the arcs of the layer are written in
+ * order.
+ * 
+ * The states of a layer are numbered in the order they were first found,
+ * as <code>generateStateSpace()</code> does, and the arcs are written in
+ * the same order too. So the output does not change.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-void StateGraph::createNewStateOW(int proc, int arc, int state, vector<int> succ)
+void StateGraph::generateStateSpaceExternal()
 {
 	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " createNewStateOW()"
+		cerr << __FILE__ << ": " << __LINE__ << " generateStateSpaceExternal()"
 			 << endl;
 	#endif
 	
-	int channel = Processes[proc]->Arcs[arc]->getChannel();
-	int type = Processes[proc]->Arcs[arc]->getIOType();
+	int bytes, first, last;
+	long memory = ExternalMemory / 4;
+	FILE *frontier, *visited;
+	vector<unsigned char> rec;
 	
-	ostringstream saux;
-	string label;
+	if (Stats != NULL) {
+		
+		Stats->begin("init");
+	}
 	
-	saux << ACM->States.size() << flush;
-	label = saux.str();
+	setStateLayout();
+	Recent.setFields(Layout);
+	RecentIds.clear();
 	
-	if (type == _ARC_WRITE) {
+	bytes = Store.getBytes();
+	rec.assign(bytes + 4, 0);
+	
+	initState(Scratch.fields);
+	Store.pack(Scratch.fields, &rec[0]);
+	RunSorter::putInt(&rec[bytes], newState());
+	
+	frontier = openScratch();
+	fwrite(&rec[0], bytes, 1, frontier);
+	visited = openScratch();
+	fwrite(&rec[0], bytes + 4, 1, visited);
+	
+	reserveScratch(&Scratch);
+	first = 0;
+	last = 1;
+	
+	if (Stats != NULL) {
+		
+		Stats->end();
+		Stats->begin("exploration");
+	}
+	
+	while (first < last) {
 		
-		ACM->insertState(label.c_str());
-		All.insert(All.end(), succ);
-		New.insert(New.begin(), ACM->getTarget(label.c_str()));
+		// the arcs whose successor was not numbered yet, as records
+		// (successor, source, position of the arc, event), and the other
+		// ones, as records (source, position of the arc, event, successor)
+		RunSorter found(ExternalDir, bytes + 12, memory);
+		RunSorter resolved(ExternalDir, 16, memory);
+		const unsigned char *r;
 		
-		Counters.insert(Counters.end(), _counters);
-		LastCounters.insert(LastCounters.end(), _lastcounters);
+		expandLayer(frontier, first, last, found, resolved);
 		
-		if (Counters[state][_ACMS_WRITER_STEP] == _ACMS_STEP_1) {
-			
-			string laux = Processes[proc]->Arcs[arc]->getLabel();
-			ostringstream saa;
-			
-			saa << "_" << flush;
-			saa << Counters[state][_ACMS_WRITER_CELL] << flush;
-			saa << Counters[state][_ACMS_WRITER_SLOT] << flush;
-			laux.append(saa.str());
+		fclose(frontier);
+		frontier = openScratch();
+		visited = numberLayer(visited, found, resolved, frontier);
+		
+		resolved.sort();
+		
+		while ((r = resolved.next()) != NULL) {
 			
-			insertArc(proc, state, ACM->getTarget(label.c_str()), laux);
+			Writer->insertArc(RunSorter::getInt(r), \
+				Arc::Events.getLabel(RunSorter::getInt(r + 8)), \
+				RunSorter::getInt(r + 12));
+		}
+		
+		first = last;
+		last = Writer->getStates();
+		
+		if (Stats != NULL && Stats->due()) {
 			
-			ACM->Arcs.back()->setIO(type, channel);
-			ACM->Arcs.back()->setOnCell(Counters[state][_ACMS_WRITER_CELL]);
-			ACM->Arcs.back()->setOnSlot(Counters[state][_ACMS_WRITER_SLOT]);
-		} else {
+			Stats->report(last, last - first, Writer->getArcs(), \
+				Recent.getLoad(), Recent.getMemory());
+		}
+	}
+	
+	fclose(frontier);
+	fclose(visited);
+	
+	SuccessorAllocations = Scratch.allocations;
+	
+	if (Stats != NULL) {
+		
+		Stats->end();
+	}
+	
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " /generateStateSpaceExternal()"
+			 << endl;
+	#endif
+}
+
+/**
+ * \brief	Expands a layer of the external generation of the state space.
+ * 
+ * \fn		void StateGraph::expandLayer(FILE *layer, int first, int last,
+ * 										RunSorter &found, RunSorter &resolved)
+ * \param	*layer: the frontier: the packed states of the layer.
+ * \param	first: the number of the first state of the layer.
+ * \param	last: the number of the first state after the layer.
+ * \param	found: where the arcs to states not known are added.
+ * \param	resolved: where the arcs to states known are added.
+ * 
+ * The successors are generated as in <code>generateSuccessors()</code> and
+ * the labels of the arcs are built by <code>createNewArc()</code>. The arcs
+ * of a state are numbered in the order they are found. If the successor is
+ * one of the <code>Recent</code> states, its number is known at once.
+ * Otherwise it is left for <code>numberLayer()</code>.
+ * 
+ * The expanded states are remembered in <code>Recent</code>. When it is
+ * full, it is emptied.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::expandLayer(FILE *layer, int first, int last,
+									RunSorter &found, RunSorter &resolved)
+{
+	int src, seq, pos, dest;
+	int bytes = Store.getBytes();
+	vector<unsigned char> rec(bytes + 12);
+	
+	rewind(layer);
+	
+	for (src = first; src < last; src++) {
+		
+		if (fread(&rec[0], bytes, 1, layer) != 1) {
 			
-			string laux = "l";
-			ostringstream saa;
+			Penknife::pkerrors(_PK_ERROR_SCRATCH, (char *) \
+				(ExternalDir == NULL ? "tmpfile()" : ExternalDir));
+			exit(_PK_ERROR_CODE_SCRATCH);
+		}
+		
+		Store.unpack(&rec[0], Scratch.state);
+		
+		if (Recent.size() >= _ACMS_EXTERNAL_CACHE) {
 			
-			saa << Counters[state][_ACMS_WRITER_CELL] << flush;
-			saa << Counters[state][_ACMS_WRITER_SLOT] << flush;
-			saa << _counters[_ACMS_WRITER_CELL] << flush;
-			saa << _counters[_ACMS_WRITER_SLOT] << flush;
-			laux.append(saa.str());
+			Recent.clear();
+			RecentIds.clear();
+		}
+		
+		if (Recent.insert(Scratch.state) == RecentIds.size()) {
 			
-			insertArc(proc, state, ACM->getTarget(label.c_str()), laux);
-
-			ACM->Arcs.back()->setIO(_ARC_CONTROL, channel);
+			RecentIds.push_back(src);
 		}
-	} else if (type == _ARC_READ) {
 		
-		if (Counters[state][_ACMS_READER_STEP] == _ACMS_STEP_2) {
+		firstSuccessor(&Scratch);
+		seq = 0;
+		
+		while (nextSuccessor(&Scratch)) {
 			
-			string laux = "m";
-			ostringstream saa;
+			if (Scratch.fields == Scratch.state) {
+				
+				continue;
+			}
 			
-			saa << Counters[state][_ACMS_READER_CELL] << flush;
-			saa << Counters[state][_ACMS_READER_SLOT] << flush;
-			saa << _counters[_ACMS_READER_CELL] << flush;
-			saa << _counters[_ACMS_READER_SLOT] << flush;
-			laux.append(saa.str());
+			createNewArc(Scratch.proc, Scratch.arc, src, src);
+			pos = Recent.find(Scratch.fields);
 			
-			if (ACMChannel->getType() == _CHANNEL_OWRRBB
-				|| Counters[state][_ACMS_READER_CELL] != \
-				   _counters[_ACMS_READER_CELL]
-				|| Counters[state][_ACMS_READER_SLOT] != \
-				   _counters[_ACMS_READER_SLOT]) {
+			if (pos != _STORE_NONE) {
 				
-				ACM->insertState(label.c_str());
-				All.insert(All.end(), succ);
-				New.insert(New.begin(), ACM->getTarget(label.c_str()));
+				dest = RecentIds[pos];
 				
-				Counters.insert(Counters.end(), _counters);
-				LastCounters.insert(LastCounters.end(), _lastcounters);
+				RunSorter::putInt(&rec[0], src);
+				RunSorter::putInt(&rec[4], seq);
+				RunSorter::putInt(&rec[8], ExternalEvent);
+				RunSorter::putInt(&rec[12], dest);
+				resolved.add(&rec[0]);
+			} else {
 				
-				insertArc(proc, state, ACM->getTarget(label.c_str()), laux);
-
-				ACM->Arcs.back()->setIO(_ARC_CONTROL, channel);
+				Store.pack(Scratch.fields, &rec[0]);
+				RunSorter::putInt(&rec[bytes], src);
+				RunSorter::putInt(&rec[bytes + 4], seq);
+				RunSorter::putInt(&rec[bytes + 8], ExternalEvent);
+				found.add(&rec[0]);
 			}
-		} else {
-			
-			ACM->insertState(label.c_str());
-			All.insert(All.end(), succ);
-			New.insert(New.begin(), ACM->getTarget(label.c_str()));
-			
-			Counters.insert(Counters.end(), _counters);
-			LastCounters.insert(LastCounters.end(), _lastcounters);
-			
-			string laux = Processes[proc]->Arcs[arc]->getLabel();
-			ostringstream saa;
-			
-			saa << "_" << flush;
-			saa << Counters[state][_ACMS_READER_CELL] << flush;
-			saa << Counters[state][_ACMS_READER_SLOT] << flush;
-			laux.append(saa.str());
 			
-			insertArc(proc, state, ACM->getTarget(label.c_str()), laux);
-			
-			ACM->Arcs.back()->setIO(type, channel);
-			ACM->Arcs.back()->setOnCell(Counters[state][_ACMS_READER_CELL]);
-			ACM->Arcs.back()->setOnSlot(Counters[state][_ACMS_READER_SLOT]);
+			seq++;
 		}
 	}
-				
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /createNewStateOW()" 
-			 << endl;
-	#endif
 }
 
 /**
- * \brief	Creates a new state and adds it to the state space.
- * 
- * \fn		void StateGraph::createNewStateRR(int proc, int arc, int state, 
-															vector<int> succ)
- * \param	proc: the target of the running process.
- * \param	arc: the target of the arc (step) of <i>proc</i> that will be
- * 			executed.
- * \param	state: the target of the current state.
- * \param	succ: the state that is reached when running the process
- * 			<i>proc</i> one step.
- * 
- * Creates a new state and adds it to the state space. This method is used only
- * in the case that the channel is of type <code>_CHANNEL_RRBB</code>.
- * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	21/09/2004
+ * \brief	Numbers the new states of a layer of the external generation of
+ * 			the state space.
+ * 
+ * \fn		FILE * StateGraph::numberLayer(FILE *visited, RunSorter &found,
+ * 										RunSorter &resolved, FILE *layer)
+ * \param	*visited: the visited states.
+ * \param	found: the arcs whose successor is not known (see
+ * 			<code>expandLayer()</code>).
+ * \param	resolved: where the arcs are added once their successor is known.
+ * \param	*layer: where the new states are written, by number.
+ * \return	The visited states, with the new ones. <i>*visited</i> is closed.
+ * 
+ * The arcs of <i>found</i> are sorted by successor and merged with the
+ * visited states, which are sorted the same way. A successor that is not
+ * there is new. The first arc that reached it, the smallest (source,
+ * position of the arc), is its key. The new states are numbered in the
+ * order of their keys, which is the order <code>generateStateSpace()</code>
+ * finds them. Meanwhile the arcs to new states wait in a sorter of their
+ * own, by key, until the number of their successor is known.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-void StateGraph::createNewStateRR(int proc, int arc, int state, vector<int> succ)
+FILE * StateGraph::numberLayer(FILE *visited, RunSorter &found,
+									RunSorter &resolved, FILE *layer)
 {
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " createNewStateRR()"
-			 << endl;
-	#endif
+	int dest;
+	bool have;
+	long memory = ExternalMemory / 4;
+	int bytes = Store.getBytes();
+	const unsigned char *f, *n, *p, *k;
+	vector<unsigned char> group(bytes + 8), v(bytes + 4), rec(bytes + 8);
+	FILE *merged;
 	
-	int channel = Processes[proc]->Arcs[arc]->getChannel();
-	int type = Processes[proc]->Arcs[arc]->getIOType();
-	int cells = ACMChannel->getCells();
+	// the new states, as records (key, state), the arcs to them, as records
+	// (key, source, position of the arc, event), and their numbers, as
+	// records (state, number)
+	RunSorter fresh(ExternalDir, bytes + 8, memory);
+	RunSorter pending(ExternalDir, 20, memory);
+	RunSorter known(ExternalDir, bytes + 4, memory);
 	
-	ostringstream saux;
-	string label;
+	found.sort();
+	rewind(visited);
 	
-	saux << ACM->States.size() << flush;
-	label = saux.str();
+	have = (fread(&v[0], bytes + 4, 1, visited) == 1);
+	f = found.next();
 	
-	if (type == _ARC_WRITE) {
-		
-		ACM->insertState(label.c_str());
+	while (f != NULL) {
 		
-		All.insert(All.end(), succ);
-		New.insert(New.begin(), ACM->getTarget(label.c_str()));
-		Counters.insert(Counters.end(), _counters);
+		memcpy(&group[0], f, bytes + 8);
 		
-		if (Counters[state][_ACMS_WRITER_STEP] == _ACMS_STEP_1) {
-			
-			string laux = Processes[proc]->Arcs[arc]->getLabel();
-			ostringstream saa;
+		while (have && memcmp(&v[0], f, bytes) < 0) {
 			
-			saa << "_" << flush;
-			saa << _counters[_ACMS_WRITER_CELL] << flush;
-			laux.append(saa.str());
+			have = (fread(&v[0], bytes + 4, 1, visited) == 1);
+		}
+		
+		if (have && memcmp(&v[0], f, bytes) == 0) {
 			
-			insertArc(proc, state, ACM->getTarget(label.c_str()), laux);
+			dest = RunSorter::getInt(&v[bytes]);
+		} else {
 			
-			ACM->Arcs.back()->setIO(type, channel);
-			ACM->Arcs.back()->setOnCell(_counters[_ACMS_WRITER_CELL]);
-		} else { // Counters[state][channel][_ACMS_WRITER_STEP] == _ACMS_STEP_2
+			dest = _ACMS_NONE;
 			
-			string laux = "l";
-			ostringstream saa;
+			memcpy(&rec[0], &group[bytes], 8);
+			memcpy(&rec[8], &group[0], bytes);
+			fresh.add(&rec[0]);
+		}
+		
+		do {
 			
-			saa << Counters[state][_ACMS_WRITER_CELL] << flush;
-			saa << _counters[_ACMS_WRITER_CELL] << flush;
-			laux.append(saa.str());
+			if (dest != _ACMS_NONE) {
+				
+				memcpy(&rec[0], f + bytes, 12);
+				RunSorter::putInt(&rec[12], dest);
+				resolved.add(&rec[0]);
+			} else {
+				
+				memcpy(&rec[0], &group[bytes], 8);
+				memcpy(&rec[8], f + bytes, 12);
+				pending.add(&rec[0]);
+			}
 			
-			insertArc(proc, state, ACM->getTarget(label.c_str()), laux);
-
-			ACM->Arcs.back()->setIO(_ARC_CONTROL, channel);
-		}
-	} else if (type == _ARC_READ) {
+			f = found.next();
+		} while (f != NULL && memcmp(f, &group[0], bytes) == 0);
+	}
+	
+	fresh.sort();
+	pending.sort();
+	
+	p = pending.next();
+	
+	while ((n = fresh.next()) != NULL) {
 		
-		ACM->insertState(label.c_str());
-		All.insert(All.end(), succ);
-		New.insert(New.begin(), ACM->getTarget(label.c_str()));
+		dest = newState();
+		fwrite(n + 8, bytes, 1, layer);
 		
-		Counters.insert(Counters.end(), _counters);
+		memcpy(&rec[0], n + 8, bytes);
+		RunSorter::putInt(&rec[bytes], dest);
+		known.add(&rec[0]);
 		
-		if (Counters[state][_ACMS_READER_STEP] == _ACMS_STEP_1) {
-			
-			string laux = "m";
-			ostringstream saa;
-			
-			saa << Counters[state][_ACMS_READER_CELL] << flush;
-			saa << _counters[_ACMS_READER_CELL] << flush;
-			laux.append(saa.str());
-			
-			insertArc(proc, state, ACM->getTarget(label.c_str()), laux);
-
-			ACM->Arcs.back()->setIO(_ARC_CONTROL, channel);
-		} else { // Counters[state][channel][_ACMS_READER_STEP] == _ACMS_STEP_2
+		while (p != NULL && memcmp(p, n, 8) == 0) {
 			
-			string laux = Processes[proc]->Arcs[arc]->getLabel();
-			ostringstream saa;
+			memcpy(&rec[0], p + 8, 12);
+			RunSorter::putInt(&rec[12], dest);
+			resolved.add(&rec[0]);
 			
-			saa << "_" << flush;
-			saa << Counters[state][_ACMS_READER_CELL] << flush;
-			laux.append(saa.str());
+			p = pending.next();
+		}
+	}
+	
+	flushScratch(layer);
+	
+	known.sort();
+	merged = openScratch();
+	
+	rewind(visited);
+	have = (fread(&v[0], bytes + 4, 1, visited) == 1);
+	k = known.next();
+	
+	while (have || k != NULL) {
+		
+		if (k == NULL || (have && memcmp(&v[0], k, bytes) < 0)) {
 			
-			insertArc(proc, state, ACM->getTarget(label.c_str()), laux);
+			fwrite(&v[0], bytes + 4, 1, merged);
+			have = (fread(&v[0], bytes + 4, 1, visited) == 1);
+		} else {
 			
-			ACM->Arcs.back()->setIO(type, channel);
-			ACM->Arcs.back()->setOnCell(Counters[state][_ACMS_READER_CELL]);
+			fwrite(k, bytes + 4, 1, merged);
+			k = known.next();
 		}
 	}
-				
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /createNewStateRR()" 
-			 << endl;
-	#endif
+	
+	flushScratch(merged);
+	fclose(visited);
+	
+	return merged;
 }
 
 /**
- * \brief	Creates a new arc and adds it to the state space.
+ * \brief	Opens a scratch file of the external generation of the state
+ * 			space.
  * 
- * \fn		void StateGraph::createNewArc(int proc, int arc, int state,
-  																	int succ)
- * \param	proc: the target of the running process.
- * \param	arc: the target of the arc being executed in<i>proc</i>.
- * \param	state: the current state of the system.
- * \param	succ: the successor state of <i>state</i>.
+ * \fn		FILE * StateGraph::openScratch()
+ * \return	The file, in <code>ExternalDir</code>.
  * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	21/09/2004
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-void StateGraph::createNewArc(int proc, int arc, int state, int succ)
+FILE * StateGraph::openScratch()
 {
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " createNewArc()" << endl;
-	#endif
+	FILE *f = Penknife::pkscratch(ExternalDir);
 	
-	if (Processes[proc]->Arcs[arc]->isIO()) {
+	setvbuf(f, NULL, _IOFBF, _SORTER_BUFFER);
+	
+	return f;
+}
+
+/**
+ * \brief	Flushes a scratch file of the external generation of the state
+ * 			space.
+ * 
+ * \fn		void StateGraph::flushScratch(FILE *f)
+ * \param	*f: the file.
+ * 
+ * Stops the generation if something could not be written (e.g. the disk is
+ * full).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::flushScratch(FILE *f)
+{
+	if (fflush(f) != 0 || ferror(f)) {
 		
-		int channel = Processes[proc]->Arcs[arc]->getChannel();
+		Penknife::pkerrors(_PK_ERROR_SCRATCH, (char *) \
+			(ExternalDir == NULL ? "tmpfile()" : ExternalDir));
+		exit(_PK_ERROR_CODE_SCRATCH);
+	}
+}
+
+/**
+ * \brief	Builds the <code>ACM</code> process from the quotient graph.
+ * 
+ * \fn		void StateGraph::expandQuotient()
+ * 
+ * A state of the full graph is a representative <i>r</i> with each channel
+ * rotated by the cell of its writer, and its successors are the successors
+ * of <i>r</i> rotated in the same way. The full graph is walked breadth
+ * first from the initial state, taking the successors in the order they
+ * were found for the representatives, so the states are numbered and the
+ * arcs created in the same order used by <code>generateStateSpace()</code>.
+ * The states of the full graph are numbered with a second
+ * <b>StateStore</b>. The labels of the arcs are built from the rotated
+ * counters, as in <code>generateStateSpaceParallel()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::expandQuotient()
+{
+	int cont, k, ch, src, dest, states;
+	vector<int> fields;
+	vector<int> reps;
+	StateStore full;
+	
+	full.setFields(Layout);
+	QuotientFirst.push_back(Quotient.size());
+	
+	initState(fields);
+	full.insert(fields);
+	reps.push_back(0);
+	newState();
+	
+	for (src = 0; src < full.size(); src++) {
+		
+		int r = reps[src];
+		
+		full.get(src, Scratch.state);
 		
-		switch (ACMChannel->getType()) {
+		for (cont = QuotientFirst[r]; cont < QuotientFirst[r + 1]; cont += 4) {
 			
-			case _CHANNEL_OWBB:
-				
-				createNewArcOW(proc, arc, state, succ);
-				break;
+			Arc *a = Processes[Quotient[cont]]->Arcs[Quotient[cont + 1]];
 			
-			case _CHANNEL_RRBB:
-				
-				createNewArcRR(proc, arc, state, succ);
-				break;
+			Store.get(Quotient[cont + 2], fields);
 			
-			case _CHANNEL_OWRRBB:
+			for (ch = 0; ch < Channels.size(); ch++) {
 				
-				createNewArcOW(proc, arc, state, succ);
-				break;
-			
-			default:
+				k = Scratch.state[ChannelBase[ch] + _ACMS_WRITER_CELL];
 				
-				Penknife::pkerrors(_ACMS_ERROR_POL_N_IMPLEMENTED, "UNKOWN");
-				exit(_ACMS_ERROR_CODE_POL_N_IMPLEMENTED);
+				if (a->isIO() && a->getChannel() == ch) {
+					
+					k -= Quotient[cont + 3];
+				}
+				
+				rotateChannel(fields, ch, k);
+			}
+			
+			states = full.size();
+			dest = full.insert(fields);
+			
+			if (full.size() > states) {
+				
+				reps.push_back(Quotient[cont + 2]);
+				newState();
+			}
+			
+			if (a->isIO()) {
+				
+				splitChannel(Scratch.state, a->getChannel(), Scratch.current, \
+					Scratch.currentlast);
+				splitChannel(fields, a->getChannel(), Scratch.counters, \
+					Scratch.lastcounters);
+			}
+			
+			createNewArc(Quotient[cont], Quotient[cont + 1], src, dest);
 		}
-	} else {
-		
-		insertArc(proc, state, succ, Processes[proc]->Arcs[arc]->getLabel());
 	}
+}
+
+/**
+ * \brief	Gets the rotation of a channel that gives the representative of
+ * 			a state.
+ * 
+ * \fn		int StateGraph::canonicalRotation(vector<int> &fields, int ch)
+ * \param	fields: the fields of the state (see <code>setStateLayout()</code>).
+ * \param	ch: the position of the channel.
+ * \return	The number of cells the channel must be rotated so its writer
+ * 			is in the cell 0.
+ * 
+ * Each state has exactly one rotation with the writer in the cell 0, so
+ * that one is the representative of its orbit.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateGraph::canonicalRotation(vector<int> &fields, int ch)
+{
+	int cells = Channels[ch]->getCells();
 	
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /createNewArc()" << endl;
-	#endif
+	return (cells - fields[ChannelBase[ch] + _ACMS_WRITER_CELL]) % cells;
 }
 
 /**
- * \brief	Creates a new arc and adds it to the state space.
+ * \brief	Rotates the cells of a channel of a state.
  * 
- * \fn		void StateGraph::createNewArcOW(int proc, int arc, int state,
-  																	int succ)
- * \param	proc: the target of the running process.
- * \param	arc: the target of the arc being executed in<i>proc</i>.
- * \param	state: the current state of the system.
- * \param	succ: the successor state of <i>state</i>.
+ * \fn		void StateGraph::rotateChannel(vector<int> &fields, int ch, int k)
+ * \param	fields: the fields of the state (see <code>setStateLayout()</code>).
+ * \param	ch: the position of the channel.
+ * \param	k: the number of cells to rotate. May be negative.
  * 
- * Creates a new arc and adds it to the state space. This method is used only
- * in the case that the channel is of type <code>_CHANNEL_OWBB</code> or 
- * <code>_CHANNEL_OWRRBB</code>.
+ * The cells of the writer and the reader and, for the <b>OW</b> policies,
+ * the cells of the last counters are moved <i>k</i> cells forward. The
+ * padding of the last counters is not touched.
  * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	21/09/2004
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-void StateGraph::createNewArcOW(int proc, int arc, int state, int succ)
+void StateGraph::rotateChannel(vector<int> &fields, int ch, int k)
 {
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " createNewArcOW()" << endl;
-	#endif
+	int cont, pairs;
+	int cells = Channels[ch]->getCells();
+	int base = ChannelBase[ch];
 	
-	int channel = Processes[proc]->Arcs[arc]->getChannel();
-	int type = Processes[proc]->Arcs[arc]->getIOType();
+	k = ((k % cells) + cells) % cells;
 	
-	if (type == _ARC_WRITE) {
+	if (k == 0) {
 		
-		if (Counters[state][_ACMS_WRITER_STEP] == _ACMS_STEP_1) {
-			
-			string laux = Processes[proc]->Arcs[arc]->getLabel();
-			ostringstream saa;
-			
-			saa << "_" << flush;
-			saa << Counters[state][_ACMS_WRITER_CELL] << flush;
-			saa << Counters[state][_ACMS_WRITER_SLOT] << flush;
-			laux.append(saa.str());
-			
-			insertArc(proc, state, succ, laux);
-			
-			ACM->Arcs.back()->setIO(type, channel);
-			ACM->Arcs.back()->setOnCell(Counters[state][_ACMS_WRITER_CELL]);
-			ACM->Arcs.back()->setOnSlot(Counters[state][_ACMS_WRITER_SLOT]);
-		} else {
-			
-			string aa = "l";
-			ostringstream saa;
-			
-			saa << Counters[state][_ACMS_WRITER_CELL] << flush;
-			saa << Counters[state][_ACMS_WRITER_SLOT] << flush;
-			saa << _counters[_ACMS_WRITER_CELL] << flush;
-			saa << _counters[_ACMS_WRITER_SLOT] << flush;
-			aa.append(saa.str());
+		return;
+	}
+	
+	fields[base + _ACMS_WRITER_CELL] = \
+		(fields[base + _ACMS_WRITER_CELL] + k) % cells;
+	fields[base + _ACMS_READER_CELL] = \
+		(fields[base + _ACMS_READER_CELL] + k) % cells;
+	
+	if (Pairs[ch] > 0) {
+		
+		base += _ACMS_OVER + 1;
+		pairs = fields[base];
+		
+		for (cont = 0; cont < pairs; cont++) {
 			
-			insertArc(proc, state, succ, aa);
-
-			ACM->Arcs.back()->setIO(_ARC_CONTROL, channel);
+			fields[base + 1 + 2 * cont] = \
+				(fields[base + 1 + 2 * cont] + k) % cells;
 		}
-	} else if (type == _ARC_READ) {
+	}
+}
+
+/**
+ * \brief	The work of a thread of <code>generateStateSpaceParallel()</code>.
+ * 
+ * \fn		void StateGraph::exploreThread(int thread, WorkPool *pool,
+								SharedStore *shared, ExplorationThread *data)
+ * \param	thread: the number of the thread.
+ * \param	*pool: the states waiting to be expanded.
+ * \param	*shared: the states generated so far.
+ * \param	*data: the data of the thread.
+ * 
+ * Expands states until there is no more work in the pool, sleeping in
+ * <code>WorkPool::take()</code> while there is nothing to steal. The
+ * successors are computed as in <code>generateSuccessors()</code>, but only
+ * with the vectors of <i>*data</i>, so many threads can do it at the same
+ * time.
+ * 
+ * The arcs are recorded in <i>*data</i> for the walk of
+ * <code>generateStateSpaceParallel()</code>, unless the state graph is
+ * streamed (see <code>replaySuccessors()</code>). When the progress is
+ * reported, the threads count the arcs they find in
+ * <code>ParallelArcs</code> and the thread 0 writes the reports.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::exploreThread(int thread, WorkPool *pool, SharedStore *shared,
+													ExplorationThread *data)
+{
+	int handle, succ, first, found;
+	bool created;
+	
+	reserveScratch(data);
+	
+	while (pool->take(thread, handle)) {
 		
-		if (Counters[state][_ACMS_READER_STEP] == _ACMS_STEP_2) {
-			
-			string laux = "m";
-			ostringstream saa;
+		shared->get(handle, data->state);
+		
+		first = data->Arcs.size();
+		found = 0;
+		
+		firstSuccessor(data);
+		
+		while (nextSuccessor(data)) {
 			
-			saa << Counters[state][_ACMS_READER_CELL] << flush;
-			saa << Counters[state][_ACMS_READER_SLOT] << flush;
-			saa << _counters[_ACMS_READER_CELL] << flush;
-			saa << _counters[_ACMS_READER_SLOT] << flush;
-			laux.append(saa.str());
+			succ = shared->insert(data->fields, created);
+			found++;
 			
-			if (ACMChannel->getType() == _CHANNEL_OWRRBB
-				|| Counters[state][_ACMS_READER_CELL] != \
-				   _counters[_ACMS_READER_CELL]
-				|| Counters[state][_ACMS_READER_SLOT] != \
-				   _counters[_ACMS_READER_SLOT]) {
+			if (created) {
 				
-				insertArc(proc, state, succ, laux);
-
-				ACM->Arcs.back()->setIO(_ARC_CONTROL, channel);
+				pool->push(thread, succ);
 			}
-		} else {
 			
-			string laux = Processes[proc]->Arcs[arc]->getLabel();
-			ostringstream saa;
+			if (Writer == NULL) {
+				
+				data->Arcs.push_back(data->proc);
+				data->Arcs.push_back(data->arc);
+				data->Arcs.push_back(succ);
+			}
+		}
+		
+		if (Writer == NULL) {
 			
-			saa << "_" << flush;
-			saa << _counters[_ACMS_READER_CELL] << flush;
-			saa << _counters[_ACMS_READER_SLOT] << flush;
-			laux.append(saa.str());
+			data->Expanded.push_back(handle);
+			data->Expanded.push_back(first);
+			data->Expanded.push_back((data->Arcs.size() - first) / 3);
+		}
+		
+		pool->done();
+		
+		if (Stats != NULL) {
 			
-			insertArc(proc, state, succ, laux);
+			ParallelArcs += found;
 			
-			ACM->Arcs.back()->setIO(type, channel);
-			ACM->Arcs.back()->setOnCell(_counters[_ACMS_READER_CELL]);
-			ACM->Arcs.back()->setOnSlot(_counters[_ACMS_READER_SLOT]);
+			if (thread == 0 && Stats->due()) {
+				
+				Stats->report(shared->size(), pool->size(), ParallelArcs, \
+					shared->getLoad(), shared->getMemory());
+			}
 		}
 	}
-	
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /createNewArcOW()" << endl;
-	#endif
 }
 
 /**
- * \brief	Creates a new arc and adds it to the state space.
- * 
- * \fn		void StateGraph::createNewArcRR(int proc, int arc, int state, int succ)
- * \param	proc: the target of the running process.
- * \param	arc: the target of the arc being executed in<i>proc</i>.
- * \param	state: the current state of the system.
- * \param	succ: the successor state of <i>state</i>.
+ * \brief	Creates the initial state of the <code>ACM</code> process.
  * 
- * Creates a new arc and adds it to the state space. This method is used only
- * in the case that the channel is of type <code>_CHANNEL_RRBB</code>.
+ * \fn		void StateGraph::createInitState()
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	21/09/2004
+ * \date	31/01/2006
  */
-void StateGraph::createNewArcRR(int proc, int arc, int state, int succ)
+void StateGraph::createInitState()
 {
 	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " createNewArcRR()" << endl;
+		cerr << __FILE__ << ": " << __LINE__ << " createInitState()" << endl;
 	#endif
 	
-	int channel = Processes[proc]->Arcs[arc]->getChannel();
-	int type = Processes[proc]->Arcs[arc]->getIOType();
-	int cells = ACMChannel->getCells();
+	setStateLayout();
+	initState(Scratch.fields);
 	
-	ostringstream saux;
-	string label;
+	Store.insert(Scratch.fields);
+	New.push_front(newState());
+	
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " /createInitState()" << endl;
+	#endif
+}
+
+/**
+ * \brief	Builds the initial state of the <code>ACM</code> process.
+ * 
+ * \fn		void StateGraph::initState(vector<int> &fields)
+ * \param	fields: where the fields of the state are stored (see
+ * 			<code>setStateLayout()</code>, which must be called before).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::initState(vector<int> &fields)
+{
+	int cont;
+	int size = Processes.size();
+	vector<int> c, l;
 	
-	saux << ACM->States.size() << flush;
-	label = saux.str();
+	fields.assign(Layout.size(), 0);
 	
-	if (type == _ARC_WRITE) {
+	for (cont = 0; cont < size; cont++) {
 		
-		if (Counters[state][_ACMS_WRITER_STEP] == _ACMS_STEP_1) {
-			
-			string laux = Processes[proc]->Arcs[arc]->getLabel();
-			ostringstream saa;
-			
-			saa << "_" << flush;
-			saa << _counters[_ACMS_WRITER_CELL] << flush;
-			laux.append(saa.str());
-			
-			insertArc(proc, state, succ, laux);
-			
-			ACM->Arcs.back()->setIO(type, channel);
-			ACM->Arcs.back()->setOnCell(_counters[_ACMS_WRITER_CELL]);
-		} else if (Counters[state][_ACMS_WRITER_STEP] == _ACMS_STEP_2) {
-			
-			string laux = "l";
-			ostringstream saa;
-			
-			saa << Counters[state][_ACMS_WRITER_CELL] << flush;
-			saa << _counters[_ACMS_WRITER_CELL] << flush;
-			laux.append(saa.str());
-			
-			insertArc(proc, state, succ, laux);
+		fields[cont] = _ACMS_INIT;
+	}
+	
+	size = Channels.size();
+	for (cont = 0; cont < size; cont++) {
+		
+		initCounters(cont, c, l);
+		encodeChannel(cont, c, l, fields);
+	}
+}
 
-			ACM->Arcs.back()->setIO(_ARC_CONTROL, channel);
-		}
-	} else if (type == _ARC_READ) {
+/**
+ * \brief	Builds the initial counters of a channel.
+ * 
+ * \fn		void StateGraph::initCounters(int ch, vector<int> &c,
+																vector<int> &l)
+ * \param	ch: the position of the channel.
+ * \param	c: where the counters are stored.
+ * \param	l: where the last counters are stored.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::initCounters(int ch, vector<int> &c, vector<int> &l)
+{
+	c.clear();
+	l.clear();
+	
+	int n = Channels[ch]->getCells();
+	switch (Channels[ch]->getType()) {
 		
-		if (Counters[state][_ACMS_READER_STEP] == _ACMS_STEP_1) {
+		case _CHANNEL_RRBB: // message ==> rr-bb
 			
-			string laux = "m";
-			ostringstream saa;
+			c.insert(c.end(), n - 1); // w = n - 1
+			c.insert(c.end(), 0); // r = 0
+			c.insert(c.end(), _ACMS_STEP_1); // write in step 0
+			c.insert(c.end(), _ACMS_STEP_1); // read in step 0
 			
-			saa << Counters[state][_ACMS_READER_CELL] << flush;
-			saa << _counters[_ACMS_READER_CELL] << flush;
-			laux.append(saa.str());
+			break;
 			
-			insertArc(proc, state, succ, laux);
-
-			ACM->Arcs.back()->setIO(_ARC_CONTROL, channel);
-		} else if (Counters[state][_ACMS_READER_STEP] == _ACMS_STEP_2) {
+		case _CHANNEL_OWBB:   // signal ==> ow-bb
+		case _CHANNEL_OWRRBB: // pool ==> ow-rr-bb
 			
-			string laux = Processes[proc]->Arcs[arc]->getLabel();
-			ostringstream saa;
+			c.insert(c.end(), 0); // w = 0
+			c.insert(c.end(), n - 1); // r = 1
+			c.insert(c.end(), _ACMS_STEP_1); // write in step 0
+			c.insert(c.end(), _ACMS_STEP_1); // read in step 0
+			c.insert(c.end(), 1); // slot de w = 1
+			c.insert(c.end(), 1); // slot de r = 1
+			c.insert(c.end(), 0); // overwrite = no
 			
-			saa << "_" << flush;
-			saa << Counters[state][_ACMS_READER_CELL] << flush;
-			laux.append(saa.str());
+			break;
 			
-			insertArc(proc, state, succ, laux);
+		default:
 			
-			ACM->Arcs.back()->setIO(type, channel);
-			ACM->Arcs.back()->setOnCell(Counters[state][_ACMS_READER_CELL]);
-		}
+			Penknife::pkerrors(_ACMS_ERROR_POL_N_IMPLEMENTED, "UNKNOWN");
+			exit(_ACMS_ERROR_CODE_POL_N_IMPLEMENTED);
 	}
-	
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /createNewArcRR()" << endl;
-	#endif
 }
 
 /**
- * \brief	Checks if there is a changing in the state vector.
+ * \brief	Generates all successors of a given state.
  * 
- * \fn		int StateGraph::nextState(int state, int proc, int pcurr, int arc, 
-																	int psucc)
- * \param	state: the target of the current state of the <code>ACM</code>.
- * \param	proc: the target of the process that will run.
- * \param	pcurr: the target of the current state of <i>proc</i>.
- * \param	arc: the target of the arc in <i>proc</i> that will execute.
- * \param	psucc: the possible successor of <i>state</i> in <i>proc</i>.
- * \return	The target of the next state. If <i>arc</i> is not an IO operation
- * 			or if there is some pending in the IO, it returns <i>succ</i>.
- * 			Otherwise, it returns <i>state</i>.
+ * \fn		void StateGraph::generateSuccessors(int state)
+ * \param	state: the state to generate the successors.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	07/09/2004
+ * \date	21/09/2004
  */
-int StateGraph::nextState(int state, int proc, int pcurr, int arc, int psucc)
+void StateGraph::generateSuccessors(int state)
 {
 	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " nextState()" << endl;
+		cerr << __FILE__ << ": " << __LINE__ << " generateSuccessors()" << endl;
 	#endif
 	
-	int channel = Processes[proc]->Arcs[arc]->getChannel();
-	int type = Processes[proc]->Arcs[arc]->getIOType();
+	int ssucc, states;
 	
-	if (type == _ARC_WRITE 
-		&& Counters[state][_ACMS_WRITER_STEP] == _ACMS_STEP_2) {
+	decodeState(state);
+	
+	if (Reduction == false || ampleSet(&Scratch) == false) {
 		
-		return psucc;
-	} else if (type == _ARC_READ
-		&& Counters[state][_ACMS_READER_STEP] == _ACMS_STEP_2) {
-			
-		return psucc;
-	} else if (type == _ARC_NONE) {
+		firstSuccessor(&Scratch);
+	}
+	
+	while (nextSuccessor(&Scratch)) {
 		
-		return psucc;
+		states = Store.size();
+		ssucc = Store.insert(Scratch.fields);
+		
+		if (Store.size() > states) {
+			
+			createNewState(Scratch.proc, Scratch.arc, state);
+		} else if (ssucc != state) {
+			
+			createNewArc(Scratch.proc, Scratch.arc, state, ssucc);
+		}
 	}
 	
 	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /nextState()" << endl;
+		cerr << __FILE__ << ": " << __LINE__ << " /generateSuccessors()" << endl;
 	#endif
-	
-	return pcurr;
 }
 
 /**
- * \brief	Generates the state vector of the next state to be reached.
- * 
- * \fn		void StateGraph::nextCounters(int proc, int arc, int state)
- * \param	proc: the target of the running process.
- * \param	arc: the target of the arc (step) of <i>proc</i> that will be
- * 			executed.
- * \param	state: the target of the current state.
- * 
- * Generates the state vector of the next state to be reached and stores the
- * result in the class attribute <code>_counters</code>. In fact this method is 
- * just a layer to call the correct method.
- * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	21/09/2004
+ * \brief	Looks for an ample set of successors of a state.
+ * 
+ * \fn		bool StateGraph::ampleSet(ExplorationThread *data)
+ * \param	*data: the buffers of the thread. The fields of the state to
+ * 			expand must be in <code>state</code>.
+ * \return	<b>true</b> if an ample set was found. Then the generation of
+ * 			the successors is started as in <code>firstSuccessor()</code>,
+ * 			but only with the arcs of one process. <b>false</b> otherwise.
+ * 
+ * The arcs leaving the state of a process are an ample set if:
+ * 	-#	there is at least one and all of them are local ones, so they are
+ * 		independent of the arcs of the other processes and do not access
+ * 		any channel. The process can not do anything else before running
+ * 		one of them;
+ * 	-#	none of them reaches a state that is already stored. The states
+ * 		are expanded breadth first, so every cycle has an arc to a state
+ * 		stored before its source: that source is fully expanded and no
+ * 		arc is postponed forever.
+ * 
+ * The processes are tried in order and the first one that works is taken.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-void StateGraph::nextCounters(int proc, int arc, int state)
+bool StateGraph::ampleSet(ExplorationThread *data)
 {
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " nextCounters()" << endl;
-	#endif
-	
-	int channel = Processes[proc]->Arcs[arc]->getChannel();
+	int cont, next;
+	int psize = Processes.size();
+	bool ample;
 	
-	if (Processes[proc]->Arcs[arc]->isIO()) {
+	for (cont = 0; cont < psize; cont++) {
 		
-		switch(ACMChannel->getType()) {
-			
-			case _CHANNEL_OWBB:
-				
-				nextCountersOW(proc, arc, state);
-				break;
+		const vector<int> &out = \
+			Processes[cont]->getOutArcs(data->state[cont]);
+		
+		ample = (out.size() != 0);
+		
+		for (next = 0; ample && next < out.size(); next += 2) {
 			
-			case _CHANNEL_RRBB:
-				
-				nextCountersRR(proc, arc, state);
-				break;
+			ample = (Processes[cont]->Arcs[out[next]]->isIO() == false);
+		}
+		
+		for (next = 0; ample && next < out.size(); next += 2) {
 			
-			case _CHANNEL_OWRRBB:
-				
-				nextCountersOW(proc, arc, state);
-				break;
+			data->fields = data->state;
+			data->fields[cont] = out[next + 1];
 			
-			default :
-				
-				Penknife::pkerrors(_ACMS_ERROR_POL_N_IMPLEMENTED, "UNKOWN");
-				exit(_ACMS_ERROR_CODE_POL_N_IMPLEMENTED);
+			ample = (Store.find(data->fields) == _STORE_NONE);
 		}
-	} else {
 		
-		_counters = Counters[state];
-	}
+		if (ample) {
+			
+			data->proc = cont;
+			data->next = 0;
+			data->lastproc = cont + 1;
+			
+			return true;
+		}
+	}
 	
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /nextCounters()" << endl;
-	#endif
+	return false;
 }
 
 /**
- * \brief	Generates the state vector of the next state to be reached.
+ * \brief	Reserves the scratch buffers of a thread.
+ * 
+ * \fn		void StateGraph::reserveScratch(ExplorationThread *data)
+ * \param	*data: the buffers of the thread.
+ * 
+ * Each buffer gets room for the largest value it can hold with the layout
+ * of the states (see <code>setStateLayout()</code>), so
+ * <code>nextSuccessor()</code> never has to allocate memory.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::reserveScratch(ExplorationThread *data)
+{
+	int csize = _ACMS_OVER + 1;
+	int lsize = 2 * _pairs + 2;
+	
+	data->state.reserve(Layout.size());
+	data->current.reserve(csize);
+	data->counters.reserve(csize);
+	data->currentlast.reserve(lsize);
+	data->lastcounters.reserve(lsize);
+	data->fields.reserve(Layout.size());
+	
+	data->allocations = 0;
+}
+
+/**
+ * \brief	Starts the generation of the successors of a state.
+ * 
+ * \fn		void StateGraph::firstSuccessor(ExplorationThread *data)
+ * \param	*data: the buffers of the thread. The fields of the state to
+ * 			expand must be in <code>state</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::firstSuccessor(ExplorationThread *data)
+{
+	data->proc = 0;
+	data->next = 0;
+	data->lastproc = Processes.size();
+}
+
+/**
+ * \brief	Generates the next successor of a state.
+ * 
+ * \fn		bool StateGraph::nextSuccessor(ExplorationThread *data)
+ * \param	*data: the buffers of the thread (see
+ * 			<code>firstSuccessor()</code>).
+ * \return	<b>true</b> if there was one more successor. <b>false</b> if all
+ * 			of them were generated.
+ * 
+ * The arcs leaving the state of each process (up to <code>lastproc</code>)
+ * are tried in order. The fields of the successor reached running an arc
+ * are written in <code>fields</code>.
+ * If the arc is an IO one, the counters of its channel are left in
+ * <code>current</code> and <code>currentlast</code> for the state and in
+ * <code>counters</code> and <code>lastcounters</code> for the successor;
+ * the other channels do not change. The process and the arc are left in
+ * <code>proc</code> and <code>arc</code>. The steps that are not moves (see
+ * <code>isMove()</code>) are skipped.
+ * 
+ * Nothing is allocated: the buffers are only overwritten. The allocations
+ * done anyway are added to <code>allocations</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool StateGraph::nextSuccessor(ExplorationThread *data)
+{
+	int pcont, dest, channel;
+	long before = Allocations::getCount();
+	Arc *a;
+	
+	while (data->proc < data->lastproc) {
+		
+		pcont = data->proc;
+		
+		const vector<int> &out = \
+			Processes[pcont]->getOutArcs(data->state[pcont]);
+		
+		if (data->next >= out.size()) {
+			
+			data->proc++;
+			data->next = 0;
+			continue;
+		}
+		
+		data->arc = out[data->next];
+		dest = out[data->next + 1];
+		data->next += 2;
+		
+		a = Processes[pcont]->Arcs[data->arc];
+		data->fields = data->state;
+		
+		if (a->isIO() == false) {
+			
+			data->fields[pcont] = dest;
+			
+			data->allocations += Allocations::getCount() - before;
+			return true;
+		}
+		
+		channel = a->getChannel();
+		splitChannel(data->state, channel, data->current, data->currentlast);
+		
+		data->fields[pcont] = nextState(data->current, pcont, \
+			data->state[pcont], data->arc, dest);
+		
+		nextCounters(pcont, data->arc, data->current, data->currentlast, \
+			data->counters, data->lastcounters);
+		
+		if (isMove(pcont, data->arc, data->current, data->counters)) {
+			
+			encodeChannel(channel, data->counters, data->lastcounters, \
+				data->fields);
+			
+			data->allocations += Allocations::getCount() - before;
+			return true;
+		}
+	}
+	
+	data->allocations += Allocations::getCount() - before;
+	return false;
+}
+
+/**
+ * \brief	Creates a new state and adds it to the state space.
  * 
- * \fn		void StateGraph::nextCountersOW(int proc, int arc, int state)
+ * \fn		void StateGraph::createNewState(int proc, int arc, int state)
  * \param	proc: the target of the running process.
  * \param	arc: the target of the arc (step) of <i>proc</i> that will be
  * 			executed.
  * \param	state: the target of the current state.
  * 
- * Generates the state vector of the next state to be reached and stores the
- * result in the class attribute <code>_counters</code>. This method is used
- * only in the case that the channel is of type <code>_CHANNEL_OWRRBB</code>.
+ * Creates a new state and adds it to the state space. The state must have
+ * been inserted in the <code>Store</code> just before. The arc from
+ * <i>state</i> to the new state is created by <code>createNewArc()</code>,
+ * so the labels are the same no matter if the successor was new or not.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	31/01/2006
+ * \date	21/09/2004
  */
-void StateGraph::nextCountersOW(int proc, int arc, int state)
+void StateGraph::createNewState(int proc, int arc, int state)
 {
 	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " nextCountersOW()" << endl;
+		cerr << __FILE__ << ": " << __LINE__ << " createNewState()" << endl;
 	#endif
 	
-	int channel = Processes[proc]->Arcs[arc]->getChannel();
-	int type = Processes[proc]->Arcs[arc]->getIOType();
-	int cells = ACMChannel->getCells();
-	int slots = ACMChannel->getSlots();
+	int target = newState();
 	
-	_counters = Counters[state];
-	_lastcounters = LastCounters[state];
+	New.push_front(target);
 	
-	isRRBB =  false;
+	createNewArc(proc, arc, state, target);
 	
-	int lastsize = _lastcounters.size();
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " /createNewState()" << endl;
+	#endif
+}
+
+/**
+ * \brief	Creates a new arc and adds it to the state space.
+ * 
+ * \fn		void StateGraph::createNewArc(int proc, int arc, int state,
+  																	int succ)
+ * \param	proc: the target of the running process.
+ * \param	arc: the target of the arc being executed in<i>proc</i>.
+ * \param	state: the current state of the system.
+ * \param	succ: the successor state of <i>state</i>.
+ * 
+ * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
+ * \date	21/09/2004
+ */
+void StateGraph::createNewArc(int proc, int arc, int state, int succ)
+{
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " createNewArc()" << endl;
+	#endif
 	
-	if (type == _ARC_WRITE) {
+	if (Processes[proc]->Arcs[arc]->isIO()) {
 		
-		int acell = _counters[_ACMS_WRITER_CELL];
+		int channel = Processes[proc]->Arcs[arc]->getChannel();
 		
-		if (_counters[_ACMS_WRITER_STEP] == _ACMS_STEP_1) {
-			
-			_counters[_ACMS_WRITER_STEP] = \
-				(_counters[_ACMS_WRITER_STEP] + 1) % 2;
-			
-		} else if (_counters[_ACMS_WRITER_STEP] == _ACMS_STEP_2) {
+		switch (Channels[channel]->getType()) {
 			
-			int nextcell = (acell + 1) % cells;
-			int nextslot = 1;
-			
-			if (nextcell == _counters[_ACMS_READER_CELL] 
-				&& nextslot == _counters[_ACMS_READER_SLOT]) {
+			case _CHANNEL_OWBB:
 				
-				nextslot = (nextslot + 1) % slots;
-			}
+				createNewArcOW(proc, arc, state, succ);
+				break;
 			
-			if (lastsize < ((cells - 1) * slots)) {
+			case _CHANNEL_RRBB:
 				
-				_lastcounters.insert(_lastcounters.begin(), \
-					_counters[_ACMS_WRITER_SLOT]);
-				_lastcounters.insert(_lastcounters.begin(), \
-					_counters[_ACMS_WRITER_CELL]);
-			} else {
+				createNewArcRR(proc, arc, state, succ);
+				break;
+			
+			case _CHANNEL_OWRRBB:
 				
-				_lastcounters.pop_back();
-				_lastcounters.pop_back();
-				_lastcounters.insert(_lastcounters.begin(), \
-					_counters[_ACMS_WRITER_SLOT]);
-				_lastcounters.insert(_lastcounters.begin(), \
-					_counters[_ACMS_WRITER_CELL]);
-			}
+				createNewArcOW(proc, arc, state, succ);
+				break;
 			
-			_counters[_ACMS_OVER] = 0 ? nextslot == 1 : 1;
+			default:
 				
-			_counters[_ACMS_WRITER_CELL] = nextcell;
-			_counters[_ACMS_WRITER_SLOT] = nextslot;
+				Penknife::pkerrors(_ACMS_ERROR_POL_N_IMPLEMENTED, "UNKOWN");
+				exit(_ACMS_ERROR_CODE_POL_N_IMPLEMENTED);
+		}
+	} else {
+		
+		insertArc(proc, state, succ, Processes[proc]->Arcs[arc]->getLabel());
+	}
+	
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " /createNewArc()" << endl;
+	#endif
+}
+
+/**
+ * \brief	Creates a new arc and adds it to the state space.
+ * 
+ * \fn		void StateGraph::createNewArcOW(int proc, int arc, int state,
+  																	int succ)
+ * \param	proc: the target of the running process.
+ * \param	arc: the target of the arc being executed in<i>proc</i>.
+ * \param	state: the current state of the system.
+ * \param	succ: the successor state of <i>state</i>.
+ * 
+ * Creates a new arc and adds it to the state space. This method is used only
+ * in the case that the channel is of type <code>_CHANNEL_OWBB</code> or 
+ * <code>_CHANNEL_OWRRBB</code>.
+ * 
+ * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
+ * \date	21/09/2004
+ */
+void StateGraph::createNewArcOW(int proc, int arc, int state, int succ)
+{
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " createNewArcOW()" << endl;
+	#endif
+	
+	int channel = Processes[proc]->Arcs[arc]->getChannel();
+	int type = Processes[proc]->Arcs[arc]->getIOType();
+	
+	if (type == _ARC_WRITE) {
+		
+		if (Scratch.current[_ACMS_WRITER_STEP] == _ACMS_STEP_1) {
+			
+			string laux = Processes[proc]->Arcs[arc]->getLabel();
+			ostringstream saa;
+			
+			saa << "_" << flush;
+			saa << Scratch.current[_ACMS_WRITER_CELL] << flush;
+			saa << Scratch.current[_ACMS_WRITER_SLOT] << flush;
+			laux.append(saa.str());
+			
+			insertArc(proc, state, succ, laux, type, channel, \
+				Scratch.current[_ACMS_WRITER_CELL], Scratch.current[_ACMS_WRITER_SLOT]);
+		} else {
+			
+			string aa = controlLabel("l", channel);
+			ostringstream saa;
+			
+			saa << Scratch.current[_ACMS_WRITER_CELL] << flush;
+			saa << Scratch.current[_ACMS_WRITER_SLOT] << flush;
+			saa << Scratch.counters[_ACMS_WRITER_CELL] << flush;
+			saa << Scratch.counters[_ACMS_WRITER_SLOT] << flush;
+			aa.append(saa.str());
 			
-			_counters[_ACMS_WRITER_STEP] = \
-				(_counters[_ACMS_WRITER_STEP] + 1) % 2;
+			insertArc(proc, state, succ, aa, _ARC_CONTROL, channel, _ARC_NONE, \
+				_ARC_NONE);
 		}
 	} else if (type == _ARC_READ) {
 		
-		int acell = _counters[_ACMS_READER_CELL];
-		
-		if (_counters[_ACMS_READER_STEP] == _ACMS_STEP_1) {
+		if (Scratch.current[_ACMS_READER_STEP] == _ACMS_STEP_2) {
 			
-			_counters[_ACMS_READER_STEP] = \
-				(_counters[_ACMS_READER_STEP] + 1) % 2;
-		} else if (_counters[_ACMS_READER_STEP] == _ACMS_STEP_2) {
+			string laux = controlLabel("m", channel);
+			ostringstream saa;
 			
-			if (_lastcounters.size() >= 2) {
-				
-				_counters[_ACMS_READER_SLOT] = _lastcounters[lastsize - 1];
-				_counters[_ACMS_READER_CELL] = _lastcounters[lastsize - 2];
-				_counters[_ACMS_OVER] = 0;
-				
-				_lastcounters.pop_back();
-				_lastcounters.pop_back();
-			}
-				
-			_counters[_ACMS_READER_STEP] = \
-				(_counters[_ACMS_READER_STEP] + 1) % 2;
+			saa << Scratch.current[_ACMS_READER_CELL] << flush;
+			saa << Scratch.current[_ACMS_READER_SLOT] << flush;
+			saa << Scratch.counters[_ACMS_READER_CELL] << flush;
+			saa << Scratch.counters[_ACMS_READER_SLOT] << flush;
+			laux.append(saa.str());
+			
+			insertArc(proc, state, succ, laux, _ARC_CONTROL, channel, _ARC_NONE, \
+				_ARC_NONE);
+		} else {
+			
+			string laux = Processes[proc]->Arcs[arc]->getLabel();
+			ostringstream saa;
+			
+			saa << "_" << flush;
+			saa << Scratch.counters[_ACMS_READER_CELL] << flush;
+			saa << Scratch.counters[_ACMS_READER_SLOT] << flush;
+			laux.append(saa.str());
+			
+			insertArc(proc, state, succ, laux, type, channel, \
+				Scratch.counters[_ACMS_READER_CELL], Scratch.counters[_ACMS_READER_SLOT]);
 		}
 	}
 	
 	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /nextCountersOW()" << endl;
+		cerr << __FILE__ << ": " << __LINE__ << " /createNewArcOW()" << endl;
 	#endif
 }
 
 /**
- * \brief	Generates the state vector of the next state to be reached.
+ * \brief	Creates a new arc and adds it to the state space.
  * 
- * \fn		void StateGraph::nextCountersRR(int proc, int arc, int state)
+ * \fn		void StateGraph::createNewArcRR(int proc, int arc, int state, int succ)
  * \param	proc: the target of the running process.
- * \param	arc: the target of the arc (step) of <i>proc</i> that will be
- * 			executed.
- * \param	state: the target of the current state.
+ * \param	arc: the target of the arc being executed in<i>proc</i>.
+ * \param	state: the current state of the system.
+ * \param	succ: the successor state of <i>state</i>.
  * 
- * Generates the state vector of the next state to be reached and stores the
- * result in the class attribute <code>_counters</code>. This method is used 
- * only in the case that the channel is of type <code>_CHANNEL_RRBB</code>.
+ * Creates a new arc and adds it to the state space. This method is used only
+ * in the case that the channel is of type <code>_CHANNEL_RRBB</code>.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	21/09/2004
  */
-void StateGraph::nextCountersRR(int proc, int arc, int state)
+void StateGraph::createNewArcRR(int proc, int arc, int state, int succ)
 {
 	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " nextCountersRR()" << endl;
+		cerr << __FILE__ << ": " << __LINE__ << " createNewArcRR()" << endl;
 	#endif
 	
 	int channel = Processes[proc]->Arcs[arc]->getChannel();
 	int type = Processes[proc]->Arcs[arc]->getIOType();
-	int cells = ACMChannel->getCells();
+	if (type == _ARC_WRITE) {
+		
+		if (Scratch.current[_ACMS_WRITER_STEP] == _ACMS_STEP_1) {
+			
+			string laux = Processes[proc]->Arcs[arc]->getLabel();
+			ostringstream saa;
+			
+			saa << "_" << flush;
+			saa << Scratch.counters[_ACMS_WRITER_CELL] << flush;
+			laux.append(saa.str());
+			
+			insertArc(proc, state, succ, laux, type, channel, \
+				Scratch.counters[_ACMS_WRITER_CELL], _ARC_NONE);
+		} else if (Scratch.current[_ACMS_WRITER_STEP] == _ACMS_STEP_2) {
+			
+			string laux = controlLabel("l", channel);
+			ostringstream saa;
+			
+			saa << Scratch.current[_ACMS_WRITER_CELL] << flush;
+			saa << Scratch.counters[_ACMS_WRITER_CELL] << flush;
+			laux.append(saa.str());
+			
+			insertArc(proc, state, succ, laux, _ARC_CONTROL, channel, _ARC_NONE, \
+				_ARC_NONE);
+		}
+	} else if (type == _ARC_READ) {
+		
+		if (Scratch.current[_ACMS_READER_STEP] == _ACMS_STEP_1) {
+			
+			string laux = controlLabel("m", channel);
+			ostringstream saa;
+			
+			saa << Scratch.current[_ACMS_READER_CELL] << flush;
+			saa << Scratch.counters[_ACMS_READER_CELL] << flush;
+			laux.append(saa.str());
+			
+			insertArc(proc, state, succ, laux, _ARC_CONTROL, channel, _ARC_NONE, \
+				_ARC_NONE);
+		} else if (Scratch.current[_ACMS_READER_STEP] == _ACMS_STEP_2) {
+			
+			string laux = Processes[proc]->Arcs[arc]->getLabel();
+			ostringstream saa;
+			
+			saa << "_" << flush;
+			saa << Scratch.current[_ACMS_READER_CELL] << flush;
+			laux.append(saa.str());
+			
+			insertArc(proc, state, succ, laux, type, channel, \
+				Scratch.current[_ACMS_READER_CELL], _ARC_NONE);
+		}
+	}
 	
-	_counters = Counters[state];
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " /createNewArcRR()" << endl;
+	#endif
+}
+
+/**
+ * \brief	Checks if there is a changing in the state vector.
+ * 
+ * \fn		int StateGraph::nextState(vector<int> &cur, int proc, int pcurr,
+																int arc, int psucc)
+ * \param	cur: the counters of the current state of the <code>ACM</code>.
+ * \param	proc: the target of the process that will run.
+ * \param	pcurr: the target of the current state of <i>proc</i>.
+ * \param	arc: the target of the arc in <i>proc</i> that will execute.
+ * \param	psucc: the possible successor of <i>state</i> in <i>proc</i>.
+ * \return	The target of the next state. If <i>arc</i> is not an IO operation
+ * 			or if there is some pending in the IO, it returns <i>succ</i>.
+ * 			Otherwise, it returns <i>state</i>.
+ * 
+ * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
+ * \date	07/09/2004
+ */
+int StateGraph::nextState(vector<int> &cur, int proc, int pcurr, int arc,
+																		int psucc)
+{
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " nextState()" << endl;
+	#endif
 	
-	isRRBB =  true;
+	int channel = Processes[proc]->Arcs[arc]->getChannel();
+	int type = Processes[proc]->Arcs[arc]->getIOType();
 	
-	if (cells == _CHANNEL_MIN_CELLS) {
+	if (type == _ARC_WRITE 
+		&& cur[_ACMS_WRITER_STEP] == _ACMS_STEP_2) {
+		
+		return psucc;
+	} else if (type == _ARC_READ
+		&& cur[_ACMS_READER_STEP] == _ACMS_STEP_2) {
+			
+		return psucc;
+	} else if (type == _ARC_NONE) {
+		
+		return psucc;
+	}
+	
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " /nextState()" << endl;
+	#endif
+	
+	return pcurr;
+}
+
+/**
+ * \brief	Generates the state vector of the next state to be reached.
+ * 
+ * \fn		void StateGraph::nextCounters(int proc, int arc, vector<int> &cur,
+							vector<int> &curlast, vector<int> &c, vector<int> &l)
+ * \param	proc: the target of the running process.
+ * \param	arc: the target of the arc (step) of <i>proc</i> that will be
+ * 			executed.
+ * \param	cur: the counters of the current state.
+ * \param	curlast: the last counters of the current state.
+ * \param	c: where the counters of the next state are stored.
+ * \param	l: where the last counters of the next state are stored.
+ * 
+ * Generates the state vector of the next state to be reached and stores the
+ * result in <i>c</i> and <i>l</i>. In fact this method is 
+ * just a layer to call the correct method.
+ * 
+ * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
+ * \date	21/09/2004
+ */
+void StateGraph::nextCounters(int proc, int arc, vector<int> &cur,
+							vector<int> &curlast, vector<int> &c, vector<int> &l)
+{
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " nextCounters()" << endl;
+	#endif
+	
+	int channel = Processes[proc]->Arcs[arc]->getChannel();
+	
+	if (Processes[proc]->Arcs[arc]->isIO()) {
+		
+		switch(Channels[channel]->getType()) {
+			
+			case _CHANNEL_OWBB:
+				
+				nextCountersOW(proc, arc, cur, curlast, c, l);
+				break;
+			
+			case _CHANNEL_RRBB:
+				
+				nextCountersRR(proc, arc, cur, curlast, c, l);
+				break;
+			
+			case _CHANNEL_OWRRBB:
+				
+				nextCountersOW(proc, arc, cur, curlast, c, l);
+				break;
+			
+			default :
+				
+				Penknife::pkerrors(_ACMS_ERROR_POL_N_IMPLEMENTED, "UNKOWN");
+				exit(_ACMS_ERROR_CODE_POL_N_IMPLEMENTED);
+		}
+	} else {
+		
+		c = cur;
+		l = curlast;
+	}
+	
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " /nextCounters()" << endl;
+	#endif
+}
+
+/**
+ * \brief	Generates the state vector of the next state to be reached.
+ * 
+ * \fn		void StateGraph::nextCountersOW(int proc, int arc, vector<int> &cur,
+							vector<int> &curlast, vector<int> &c, vector<int> &l)
+ * \param	proc: the target of the running process.
+ * \param	arc: the target of the arc (step) of <i>proc</i> that will be
+ * 			executed.
+ * \param	cur: the counters of the current state.
+ * \param	curlast: the last counters of the current state.
+ * \param	c: where the counters of the next state are stored.
+ * \param	l: where the last counters of the next state are stored.
+ * 
+ * Generates the state vector of the next state to be reached and stores the
+ * result in <i>c</i> and <i>l</i>. This method is used
+ * only in the case that the channel is of type <code>_CHANNEL_OWRRBB</code>.
+ * 
+ * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
+ * \date	31/01/2006
+ */
+void StateGraph::nextCountersOW(int proc, int arc, vector<int> &cur,
+							vector<int> &curlast, vector<int> &c, vector<int> &l)
+{
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " nextCountersOW()" << endl;
+	#endif
+	
+	int channel = Processes[proc]->Arcs[arc]->getChannel();
+	int type = Processes[proc]->Arcs[arc]->getIOType();
+	int cells = Channels[channel]->getCells();
+	int slots = Channels[channel]->getSlots();
+	
+	c = cur;
+	l = curlast;
+	
+	int lastsize = l.size();
+	
+	if (type == _ARC_WRITE) {
+		
+		int acell = c[_ACMS_WRITER_CELL];
+		
+		if (c[_ACMS_WRITER_STEP] == _ACMS_STEP_1) {
+			
+			c[_ACMS_WRITER_STEP] = \
+				(c[_ACMS_WRITER_STEP] + 1) % 2;
+			
+		} else if (c[_ACMS_WRITER_STEP] == _ACMS_STEP_2) {
+			
+			int nextcell = (acell + 1) % cells;
+			int nextslot = 1;
+			
+			if (nextcell == c[_ACMS_READER_CELL] 
+				&& nextslot == c[_ACMS_READER_SLOT]) {
+				
+				nextslot = (nextslot + 1) % slots;
+			}
+			
+			if (lastsize < ((cells - 1) * slots)) {
+				
+				l.insert(l.begin(), \
+					c[_ACMS_WRITER_SLOT]);
+				l.insert(l.begin(), \
+					c[_ACMS_WRITER_CELL]);
+			} else {
+				
+				l.pop_back();
+				l.pop_back();
+				l.insert(l.begin(), \
+					c[_ACMS_WRITER_SLOT]);
+				l.insert(l.begin(), \
+					c[_ACMS_WRITER_CELL]);
+			}
+			
+			c[_ACMS_OVER] = 0 ? nextslot == 1 : 1;
+				
+			c[_ACMS_WRITER_CELL] = nextcell;
+			c[_ACMS_WRITER_SLOT] = nextslot;
+			
+			c[_ACMS_WRITER_STEP] = \
+				(c[_ACMS_WRITER_STEP] + 1) % 2;
+		}
+	} else if (type == _ARC_READ) {
+		
+		int acell = c[_ACMS_READER_CELL];
+		
+		if (c[_ACMS_READER_STEP] == _ACMS_STEP_1) {
+			
+			c[_ACMS_READER_STEP] = \
+				(c[_ACMS_READER_STEP] + 1) % 2;
+		} else if (c[_ACMS_READER_STEP] == _ACMS_STEP_2) {
+			
+			if (l.size() >= 2) {
+				
+				c[_ACMS_READER_SLOT] = l[lastsize - 1];
+				c[_ACMS_READER_CELL] = l[lastsize - 2];
+				c[_ACMS_OVER] = 0;
+				
+				l.pop_back();
+				l.pop_back();
+			}
+				
+			c[_ACMS_READER_STEP] = \
+				(c[_ACMS_READER_STEP] + 1) % 2;
+		}
+	}
+	
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " /nextCountersOW()" << endl;
+	#endif
+}
+
+/**
+ * \brief	Generates the state vector of the next state to be reached.
+ * 
+ * \fn		void StateGraph::nextCountersRR(int proc, int arc, vector<int> &cur,
+							vector<int> &curlast, vector<int> &c, vector<int> &l)
+ * \param	proc: the target of the running process.
+ * \param	arc: the target of the arc (step) of <i>proc</i> that will be
+ * 			executed.
+ * \param	cur: the counters of the current state.
+ * \param	curlast: the last counters of the current state. Not used: it
+ * 			is only passed as to <code>nextCountersOW()</code>.
+ * \param	c: where the counters of the next state are stored.
+ * \param	l: where the last counters of the next state are stored.
+ * 
+ * Generates the state vector of the next state to be reached and stores the
+ * result in <i>c</i> and <i>l</i>. This method is used 
+ * only in the case that the channel is of type <code>_CHANNEL_RRBB</code>.
+ * 
+ * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
+ * \date	21/09/2004
+ */
+void StateGraph::nextCountersRR(int proc, int arc, vector<int> &cur,
+							vector<int> &, vector<int> &c, vector<int> &l)
+{
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " nextCountersRR()" << endl;
+	#endif
+	
+	int channel = Processes[proc]->Arcs[arc]->getChannel();
+	int type = Processes[proc]->Arcs[arc]->getIOType();
+	int cells = Channels[channel]->getCells();
+	
+	c = cur;
+	l.clear();
+	
+	if (cells == _CHANNEL_MIN_CELLS) {
+		
+		if (type == _ARC_WRITE) {
+			
+			int next = (c[_ACMS_WRITER_CELL] + 1) % cells;
+			
+			if (c[_ACMS_WRITER_STEP] == _ACMS_STEP_1
+				&& c[_ACMS_READER_CELL] != \
+				   c[_ACMS_WRITER_CELL]) {
+				
+				c[_ACMS_WRITER_STEP] = _ACMS_STEP_2;
+			} else if (c[_ACMS_WRITER_STEP] == _ACMS_STEP_2) {
+				
+				c[_ACMS_WRITER_CELL] = next;
+				c[_ACMS_WRITER_STEP] = _ACMS_STEP_1;
+			}
+		} else if (type == _ARC_READ) {
+			
+			if (c[_ACMS_READER_STEP] == _ACMS_STEP_1) {
+				
+				c[_ACMS_READER_CELL] = \
+					(c[_ACMS_WRITER_CELL] + 1) % cells;
+			}
+			
+			c[_ACMS_READER_STEP] = \
+				(c[_ACMS_READER_STEP] + 1) % 2;
+		}
+	} else if (cells > _CHANNEL_MIN_CELLS) {
+		
+		if (type == _ARC_WRITE) {
+			
+			int next = (c[_ACMS_WRITER_CELL] + 1) % cells;
+			
+			if (c[_ACMS_WRITER_STEP] == _ACMS_STEP_1) {
+				
+				c[_ACMS_WRITER_STEP] = _ACMS_STEP_2;
+			} else if (c[_ACMS_WRITER_STEP] == _ACMS_STEP_2
+				&& c[_ACMS_READER_CELL] != next) {
+				
+				c[_ACMS_WRITER_CELL] = next;
+				c[_ACMS_WRITER_STEP] = _ACMS_STEP_1;
+			}
+		} else if (type == _ARC_READ) {
+			
+			int next = (c[_ACMS_READER_CELL] + 1) % cells;
+			
+			if (c[_ACMS_READER_STEP] == _ACMS_STEP_1
+				&& next != c[_ACMS_WRITER_CELL]) {
+				
+				c[_ACMS_READER_CELL] = next;
+			}
+			
+			c[_ACMS_READER_STEP] = \
+				(c[_ACMS_READER_STEP] + 1) % 2;
+		}
+	}
+	
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " /nextCountersRR()"
+			 << endl;
+	#endif
+}
+
+/**
+ * \brief	Checks if running one step of a process changes the system.
+ * 
+ * \fn		bool StateGraph::isMove(int proc, int arc, vector<int> &cur,
+																vector<int> &c)
+ * \param	proc: the target of the running process.
+ * \param	arc: the target of the arc (step) of <i>proc</i> that is executed.
+ * \param	cur: the counters of the current state.
+ * \param	c: the counters of the next state (see <code>nextCounters()</code>).
+ * \return	<b>false</b> if the step must not appear in the <code>ACM</code>.
+ * 			<b>true</b> otherwise.
+ * 
+ * In a <b>OWBB</b> channel, the second part of a read operation is not
+ * considered when the reader does not move to another (cell,slot).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool StateGraph::isMove(int proc, int arc, vector<int> &cur, vector<int> &c)
+{
+	Arc *a = Processes[proc]->Arcs[arc];
+	
+	if (a->isIO()
+		&& Channels[a->getChannel()]->getType() == _CHANNEL_OWBB
+		&& a->getIOType() == _ARC_READ
+		&& cur[_ACMS_READER_STEP] == _ACMS_STEP_2
+		&& cur[_ACMS_READER_CELL] == c[_ACMS_READER_CELL]
+		&& cur[_ACMS_READER_SLOT] == c[_ACMS_READER_SLOT]) {
+		
+		return false;
+	}
+	
+	return true;
+}
+
+/**
+ * \brief	Sets the layout of the states in the <code>Store</code>.
+ * 
+ * \fn		void StateGraph::setStateLayout()
+ * 
+ * A state is stored as a sequence of fields, each one as narrow as the
+ * values it can hold:
+ * 	-#	one field for the current state of each process;
+ * 	-#	one block for each channel, starting at <code>ChannelBase</code>,
+ * 		with:
+ * 		-#	the counters of the channel (see <code>Scratch.current</code>).
+ * 			Cells and slots need only a few bits and steps and the
+ * 			overwriting bit just one;
+ * 		-#	for the <b>OW</b> policies, the number of (cell,slot) pairs in
+ * 			the last counters and the pairs themselves, padded with zeros
+ * 			up to the capacity of the channel.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::setStateLayout()
+{
+	int cont, ch, size;
+	vector<int> &bits = Layout;
+	
+	bits.clear();
+	Pairs.clear();
+	ChannelBase.clear();
+	_pairs = 0;
+	
+	size = Processes.size();
+	for (cont = 0; cont < size; cont++) {
+		
+		bits.push_back(StateStore::bitsFor(Processes[cont]->States.size()));
+	}
+	
+	for (ch = 0; ch < Channels.size(); ch++) {
+		
+		int cells = Channels[ch]->getCells();
+		int slots = Channels[ch]->getSlots();
+		
+		// the initial slot is 1 even for channels with only one slot
+		int cbits = StateStore::bitsFor(cells);
+		int sbits = StateStore::bitsFor(slots < 2 ? 2 : slots);
+		
+		ChannelBase.push_back(bits.size());
+		Pairs.push_back(0);
+		
+		bits.push_back(cbits); // _ACMS_WRITER_CELL
+		bits.push_back(cbits); // _ACMS_READER_CELL
+		bits.push_back(1); // _ACMS_WRITER_STEP
+		bits.push_back(1); // _ACMS_READER_STEP
+		
+		if (Channels[ch]->getType() != _CHANNEL_RRBB) {
+			
+			bits.push_back(sbits); // _ACMS_WRITER_SLOT
+			bits.push_back(sbits); // _ACMS_READER_SLOT
+			bits.push_back(1); // _ACMS_OVER
+			
+			// see nextCountersOW(): pairs are added while there are less
+			// than (cells - 1) * slots integers
+			Pairs[ch] = ((cells - 1) * slots + 1) / 2;
+			
+			bits.push_back(StateStore::bitsFor(Pairs[ch] + 1));
+			
+			for (cont = 0; cont < Pairs[ch]; cont++) {
+				
+				bits.push_back(cbits);
+				bits.push_back(sbits);
+			}
+			
+			if (Pairs[ch] > _pairs) {
+				
+				_pairs = Pairs[ch];
+			}
+		}
+	}
+	
+	Store.setFields(bits);
+}
+
+/**
+ * \brief	Writes the counters of a channel in the fields of a state.
+ * 
+ * \fn		void StateGraph::encodeChannel(int ch, vector<int> &c,
+											vector<int> &l, vector<int> &fields)
+ * \param	ch: the position of the channel.
+ * \param	c: the counters of the channel.
+ * \param	l: the last counters of the channel.
+ * \param	fields: the fields of the state. Only the block of <i>ch</i> is
+ * 			written.
+ * 
+ * The last counters are part of the state only if the channel is not a
+ * <b>RRBB</b> one (see <code>setStateLayout()</code>).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::encodeChannel(int ch, vector<int> &c, vector<int> &l,
+														vector<int> &fields)
+{
+	vector<int>::iterator i = fields.begin() + ChannelBase[ch];
+	
+	i = copy(c.begin(), c.end(), i);
+	
+	if (Pairs[ch] > 0) {
+		
+		*i++ = l.size() / 2;
+		i = copy(l.begin(), l.end(), i);
+		fill(i, i + 2 * Pairs[ch] - l.size(), 0);
+	}
+}
+
+/**
+ * \brief	Unpacks a state of the <code>Store</code>.
+ * 
+ * \fn		void StateGraph::decodeState(int state)
+ * \param	state: the position of the state.
+ * 
+ * The fields of the state are stored in <code>Scratch.state</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::decodeState(int state)
+{
+	Store.get(state, Scratch.state);
+}
+
+/**
+ * \brief	Gets the counters of a channel from the fields of a state (see
+ * 			<code>encodeChannel()</code>).
+ * 
+ * \fn		void StateGraph::splitChannel(vector<int> &fields, int ch,
+											vector<int> &c, vector<int> &l)
+ * \param	fields: the fields of the state.
+ * \param	ch: the position of the channel.
+ * \param	c: where the counters are stored.
+ * \param	l: where the last counters are stored.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::splitChannel(vector<int> &fields, int ch, vector<int> &c,
+															vector<int> &l)
+{
+	int csize = Pairs[ch] == 0 ? _ACMS_WRITER_SLOT : _ACMS_OVER + 1;
+	
+	vector<int>::iterator i = fields.begin() + ChannelBase[ch];
+	
+	c.assign(i, i + csize);
+	l.clear();
+	
+	if (Pairs[ch] > 0) {
+		
+		int pairs = i[csize];
+		
+		i += csize + 1;
+		l.assign(i, i + 2 * pairs);
+	}
+}
+
+/**
+ * \brief	Builds the label of a control arc of a channel.
+ * 
+ * \fn		string StateGraph::controlLabel(const char *prefix, int ch)
+ * \param	*prefix: <code>"l"</code> for the writer or <code>"m"</code> for
+ * 			the reader.
+ * \param	ch: the position of the channel.
+ * \return	<i>prefix</i> alone if there is only one channel. Otherwise
+ * 			<i>prefix</i> followed by the label of the channel and
+ * 			<code>"_"</code>, so the control events of two channels are
+ * 			different.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+string StateGraph::controlLabel(const char *prefix, int ch)
+{
+	string label = prefix;
+	
+	if (Channels.size() > 1) {
+		
+		label.append(Channels[ch]->getLabel());
+		label.append("_");
+	}
+	
+	return label;
+}
+
+/**
+ * \brief	Prints the comments at the beginning of a <b>petrify</b> file.
+ * 
+ * \fn		static void StateGraph::petrifyComments(char *cmd[], int states,
+ * 															int arcs)
+ * \param	*cmd[]: the command line.
+ * \param	states: the number of states of the state graph.
+ * \param	arcs: the number of arcs of the state graph.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::petrifyComments(char *cmd[], int states, int arcs)
+{
+	petrifyHeader(cmd);
+	
+	cout << "# ";
+	cout << states << " states -- ";
+	cout << arcs << " arcs" << endl;
+}
+
+/**
+ * \brief	Prints the comments at the beginning of a <b>petrify</b> file
+ * 			with a Petri net.
+ * 
+ * \fn		static void StateGraph::petrinetComments(char *cmd[], int places,
+ * 														int transitions)
+ * \param	*cmd[]: the command line.
+ * \param	places: the number of places of the net.
+ * \param	transitions: the number of transitions of the net.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::petrinetComments(char *cmd[], int places, int transitions)
+{
+	petrifyHeader(cmd);
+	
+	cout << "# ";
+	cout << places << " places -- ";
+	cout << transitions << " transitions" << endl;
+}
+
+/**
+ * \brief	Prints the version, the command line and the date at the
+ * 			beginning of a <b>petrify</b> file.
+ * 
+ * \fn		static void StateGraph::petrifyHeader(char *cmd[])
+ * \param	*cmd[]: the command line.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::petrifyHeader(char *cmd[])
+{
+	time_t rawtime;
+	struct tm * timeinfo;
+
+	time(&rawtime);
+	timeinfo = localtime(&rawtime);
+	
+	cout << "# Generated by jabuti " << _acms_version << " (compiled "
+		 << __DATE__ << " at " << __TIME__ << ")" << endl;
+	cout << "#";
+	
+	int i = 0;
+	while (cmd[i] != NULL) cout << " " << cmd[i++];
+	
+	cout << endl;
+	cout << "# " << asctime(timeinfo);
+}
+
+/**
+ * \brief	Prints the lists of events at the beginning of a <b>petrify</b>
+ * 			file (<code>.internal</code>, <code>.outputs</code>,
+ * 			<code>.dummy</code> and <code>.process</code>).
+ * 
+ * \fn		void StateGraph::petrifyEvents()
+ * 
+ * The lists are taken from <code>Events</code>, so the arcs are not looked
+ * at again.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::petrifyEvents()
+{
+	const char *heads[] = {".internal", ".outputs", ".dummy"};
+	int cont, c2;
+	
+	for (cont = _EVENTS_INTERNAL; cont <= _EVENTS_DUMMY; cont++) {
+		
+		vector<int> &events = Events.getClass(cont);
+		
+		if (events.size() > 0) {
+			
+			cout << heads[cont];
+			
+			for (c2 = 0; c2 < events.size(); c2++) {
+				
+				cout << " " << Arc::Events.getLabel(events[c2]);
+			}
+			
+			cout << endl;
+		}
+	}
+	
+	for (cont = 0; cont < Processes.size(); cont++) {
+		
+		vector<int> &events = Events.getProcess(cont);
+		
+		cout << ".process " << cont;
+		
+		for (c2 = 0; c2 < events.size(); c2++) {
+			
+			cout << " " << Arc::Events.getLabel(events[c2]);
+		}
+		
+		cout << endl;
+	}
+}
+
+/**
+ * \brief	Inserts a new <b>Arc</b> in the process <b>ACM</b>.
+ * 
+ * \fn		void StateGraph::insertArc(int proc, int src, int dest, string lab)
+ * \param	proc: target of the process.
+ * \param	src: target of the source state in process <i>proc</i>.
+ * \param	dest: target of the destination state in process <i>proc</i>.
+ * \param	lab: the label of the arc to be created.
+ * 
+ * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
+ * \date	20/07/2004
+ */
+void StateGraph::insertArc(int proc, int src, int dest, string lab)
+{
+	insertArc(proc, src, dest, lab, _ARC_NONE, _ARC_NONE, _ARC_NONE, \
+		_ARC_NONE);
+}
+
+/**
+ * \brief	Inserts a new <b>Arc</b> in the process <b>ACM</b>.
+ * 
+ * \fn		void StateGraph::insertArc(int proc, int src, int dest, string lab,
+ * 											int type, int ch, int cell, int slot)
+ * \param	proc: target of the process.
+ * \param	src: target of the source state in process <i>proc</i>.
+ * \param	dest: target of the destination state in process <i>proc</i>.
+ * \param	lab: the label of the arc to be created.
+ * \param	type: the IO type of the arc. If it is <code>_ARC_NONE</code>
+ * 			the arc is not an IO one and <i>ch</i>, <i>cell</i> and
+ * 			<i>slot</i> are ignored.
+ * \param	ch: the target of the channel.
+ * \param	cell: the cell of the IO operation, or <code>_ARC_NONE</code>.
+ * \param	slot: the slot of the IO operation, or <code>_ARC_NONE</code>.
+ * 
+ * The event of the arc is registered in <code>Events</code>. If the state
+ * graph is being streamed (see <code>setStream()</code>), the arc is written
+ * by the <code>Writer</code> instead. If it is generated in external memory,
+ * the arc is not written: its event is left in <code>ExternalEvent</code>
+ * (see <code>expandLayer()</code>).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::insertArc(int proc, int src, int dest, string lab, int type,
+												int ch, int cell, int slot)
+{
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " insertArc()" << endl;
+	#endif
+	
+	string label;
+	
+	label = Processes[proc]->getLabel();
+	label.append(".");
+	label.append(lab);
+	
+	if (External) {
+		
+		ExternalEvent = Arc::Events.insert(label);
+		Events.insert(ExternalEvent, type);
+		return;
+	}
+	
+	if (Writer != NULL) {
+		
+		Writer->insertArc(src, label, dest);
+		Events.insert(Arc::Events.insert(label), type);
+		return;
+	}
+	
+	ACM->insertArc(src, label.c_str(), dest);
+	Events.insert(ACM->Arcs.back()->getEvent(), type);
+	
+	if (type != _ARC_NONE) {
+		
+		ACM->Arcs.back()->setIO(type, ch);
+		ACM->Arcs.back()->setOnCell(cell);
+		ACM->Arcs.back()->setOnSlot(slot);
+	}
+	
+	#ifdef _JABUTI_ACMS_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " /insertArc()" << endl;
+	#endif
+}
+
+/**
+ * \brief	Inserts a new state in the process <b>ACM</b>.
+ * 
+ * \fn		int StateGraph::newState()
+ * \return	The target of the new state. Its label is the target itself, and
+ * 			it is only written at the output.
+ * 
+ * If the state graph is being streamed (see <code>setStream()</code>), the
+ * state is counted by the <code>Writer</code> instead.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateGraph::newState()
+{
+	if (Writer != NULL) {
+		
+		return Writer->insertState();
+	}
+	
+	return ACM->insertState();
+}
+
+/**
+ * \brief	Converts an <code>ACM</code> into a <code>PNmodel</code>.
+ * 
+ * \fn		PNmodel * StateGraph::acm2petrinet(void)
+ * \return	The Petri net of the system. It must be freed by the caller.
+ * 
+ * The net is built from the structure of the system, without generating
+ * the state space, and its reachability graph is the <code>ACM</code>:
+ * 	-#	each state of a process with more than one state is a place, marked
+ * 		if it is the initial one;
+ * 	-#	each channel has a place for each value of its step counters and of
+ * 		the counters of each cell, and the complements of the ones that are
+ * 		tested (see <code>acm2petrinetRR()</code> and
+ * 		<code>acm2petrinetOW()</code>);
+ * 	-#	each arc of a process is a transition for each value of the
+ * 		counters it reads, labelled with the event of the arc of the
+ * 		<code>ACM</code>. The transitions of the same event are named as
+ * 		instances of it (<code>e</code>, <code>e/1</code>, ...).
+ * 
+ * So there is one marking for each state of the <code>ACM</code> and one
+ * transition enabled for each arc leaving it. The steps that do not change
+ * the state are not transitions, as they are not arcs of the
+ * <code>ACM</code>. The size of the net is linear in the number of events.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+PNmodel * StateGraph::acm2petrinet(void)
+{
+	int cont, c2;
+	
+	Net = new PNmodel();
+	Net->setLabel(ACM->getLabel());
+	
+	NetInstances.clear();
+	NetStates.assign(Processes.size(), vector<int>());
+	NetBase.assign(Channels.size(), 0);
+	
+	for (cont = 0; cont < Processes.size(); cont++) {
+		
+		Process *p = Processes[cont];
+		
+		if (p->States.size() < 2) {
+			
+			// it is always in its only state
+			continue;
+		}
+		
+		for (c2 = 0; c2 < p->States.size(); c2++) {
+			
+			NetStates[cont].push_back(netPlace(p->getLabel() + "." + \
+				p->States[c2]->getLabel(), c2 == _ACMS_INIT));
+		}
+	}
+	
+	for (cont = 0; cont < Channels.size(); cont++) {
+		
+		switch (Channels[cont]->getType()) {
+			
+			case _CHANNEL_RRBB:
+				
+				acm2petrinetRR(cont);
+				break;
+			
+			case _CHANNEL_OWBB:
+			case _CHANNEL_OWRRBB:
+				
+				acm2petrinetOW(cont);
+				break;
+			
+			default:
+				
+				Penknife::pkerrors(_ACMS_ERROR_POL_N_IMPLEMENTED, "UNKNOWN");
+				exit(_ACMS_ERROR_CODE_POL_N_IMPLEMENTED);
+		}
+	}
+	
+	for (cont = 0; cont < Processes.size(); cont++) {
 		
-		if (type == _ARC_WRITE) {
+		for (c2 = 0; c2 < Processes[cont]->Arcs.size(); c2++) {
 			
-			int next = (_counters[_ACMS_WRITER_CELL] + 1) % cells;
+			Arc *a = Processes[cont]->Arcs[c2];
 			
-			if (_counters[_ACMS_WRITER_STEP] == _ACMS_STEP_1
-				&& _counters[_ACMS_READER_CELL] != \
-				   _counters[_ACMS_WRITER_CELL]) {
-				
-				_counters[_ACMS_WRITER_STEP] = _ACMS_STEP_2;
-			} else if (_counters[_ACMS_WRITER_STEP] == _ACMS_STEP_2) {
+			if (a->isIO() == false && a->getSrc() != a->getDest()) {
 				
-				_counters[_ACMS_WRITER_CELL] = next;
-				_counters[_ACMS_WRITER_STEP] = _ACMS_STEP_1;
-			}
-		} else if (type == _ARC_READ) {
-			
-			if (_counters[_ACMS_READER_STEP] == _ACMS_STEP_1) {
+				int t = netTransition(cont, a->getLabel(), _ARC_NONE);
 				
-				_counters[_ACMS_READER_CELL] = \
-					(_counters[_ACMS_WRITER_CELL] + 1) % cells;
+				netProcess(t, cont, a->getSrc(), a->getDest());
 			}
-			
-			_counters[_ACMS_READER_STEP] = \
-				(_counters[_ACMS_READER_STEP] + 1) % 2;
 		}
-	} else if (cells > _CHANNEL_MIN_CELLS) {
+	}
+	
+	PNmodel *pn = Net;
+	
+	Net = NULL;
+	
+	return pn;
+}
+
+/**
+ * \brief	Builds the places of a <b>RRBB</b> channel and the transitions
+ * 			of its IO arcs.
+ * 
+ * \fn		void StateGraph::acm2petrinetRR(int ch)
+ * \param	ch: the position of the channel.
+ * 
+ * Besides the steps, each cell <i>i</i> has the places
+ * <code>w</code><i>i</i> and <code>r</code><i>i</i>, marked when the writer
+ * or the reader is in it, and their complements <code>nw</code><i>i</i> and
+ * <code>nr</code><i>i</i>, read by the transitions that need the other
+ * process out of a cell. The transitions follow
+ * <code>nextCountersRR()</code> and their events
+ * <code>createNewArcRR()</code>: each arc has a few of them for each cell,
+ * so the net is linear in the number of cells.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::acm2petrinetRR(int ch)
+{
+	int cont, c2, i, j, k, t;
+	int n = Channels[ch]->getCells();
+	vector<int> c, l;
+	
+	initCounters(ch, c, l);
+	
+	NetBase[ch] = netPlace(controlLabel("wstep", ch) + "1", \
+		c[_ACMS_WRITER_STEP] == _ACMS_STEP_1);
+	netPlace(controlLabel("wstep", ch) + "2", \
+		c[_ACMS_WRITER_STEP] == _ACMS_STEP_2);
+	netPlace(controlLabel("rstep", ch) + "1", \
+		c[_ACMS_READER_STEP] == _ACMS_STEP_1);
+	netPlace(controlLabel("rstep", ch) + "2", \
+		c[_ACMS_READER_STEP] == _ACMS_STEP_2);
+	
+	for (i = 0; i < n; i++) {
+		
+		ostringstream cell;
+		
+		cell << i;
+		
+		netPlace(controlLabel("w", ch) + cell.str(), \
+			c[_ACMS_WRITER_CELL] == i);
+		netPlace(controlLabel("nw", ch) + cell.str(), \
+			c[_ACMS_WRITER_CELL] != i);
+		netPlace(controlLabel("r", ch) + cell.str(), \
+			c[_ACMS_READER_CELL] == i);
+		netPlace(controlLabel("nr", ch) + cell.str(), \
+			c[_ACMS_READER_CELL] != i);
+	}
+	
+	int ws1 = NetBase[ch] + _NET_WRITER_STEP_1;
+	int ws2 = NetBase[ch] + _NET_WRITER_STEP_2;
+	int rs1 = NetBase[ch] + _NET_READER_STEP_1;
+	int rs2 = NetBase[ch] + _NET_READER_STEP_2;
+	
+	for (cont = 0; cont < Processes.size(); cont++) {
 		
-		if (type == _ARC_WRITE) {
+		for (c2 = 0; c2 < Processes[cont]->Arcs.size(); c2++) {
 			
-			int next = (_counters[_ACMS_WRITER_CELL] + 1) % cells;
+			Arc *a = Processes[cont]->Arcs[c2];
 			
-			if (_counters[_ACMS_WRITER_STEP] == _ACMS_STEP_1) {
-				
-				_counters[_ACMS_WRITER_STEP] = _ACMS_STEP_2;
-			} else if (_counters[_ACMS_WRITER_STEP] == _ACMS_STEP_2
-				&& _counters[_ACMS_READER_CELL] != next) {
+			if (a->isIO() == false || a->getChannel() != ch) {
 				
-				_counters[_ACMS_WRITER_CELL] = next;
-				_counters[_ACMS_WRITER_STEP] = _ACMS_STEP_1;
+				continue;
 			}
-		} else if (type == _ARC_READ) {
 			
-			int next = (_counters[_ACMS_READER_CELL] + 1) % cells;
+			int src = a->getSrc();
+			int dest = a->getDest();
 			
-			if (_counters[_ACMS_READER_STEP] == _ACMS_STEP_1
-				&& next != _counters[_ACMS_WRITER_CELL]) {
+			for (i = 0; i < n; i++) {
+				
+				j = (i + 1) % n;
 				
-				_counters[_ACMS_READER_CELL] = next;
+				ostringstream first, move, stay;
+				
+				if (a->getIOType() == _ARC_WRITE) {
+					
+					first << "_" << i;
+					move << controlLabel("l", ch) << i << j;
+					stay << controlLabel("l", ch) << i << i;
+					
+					// writes the cell, if the reader is not in it when
+					// there are only two cells
+					t = netTransition(cont, a->getLabel() + first.str(), \
+						_ARC_WRITE);
+					netMove(t, ws1, ws2);
+					netMove(t, netCell(ch, i, _NET_RR_W), \
+						netCell(ch, i, _NET_RR_W));
+					netProcess(t, cont, src, src);
+					
+					if (n == _CHANNEL_MIN_CELLS) {
+						
+						netMove(t, netCell(ch, i, _NET_RR_NOT_R), \
+							netCell(ch, i, _NET_RR_NOT_R));
+					}
+					
+					// moves to the next cell, if the reader is not in it
+					// when there are more than two cells
+					t = netTransition(cont, move.str(), _ARC_CONTROL);
+					netMove(t, ws2, ws1);
+					netMove(t, netCell(ch, i, _NET_RR_W), \
+						netCell(ch, j, _NET_RR_W));
+					netMove(t, netCell(ch, j, _NET_RR_NOT_W), \
+						netCell(ch, i, _NET_RR_NOT_W));
+					netProcess(t, cont, src, dest);
+					
+					if (n == _CHANNEL_MIN_CELLS) {
+						
+						continue;
+					}
+					
+					netMove(t, netCell(ch, j, _NET_RR_NOT_R), \
+						netCell(ch, j, _NET_RR_NOT_R));
+					
+					// the reader is in the next cell: only the process
+					// moves
+					if (src != dest) {
+						
+						t = netTransition(cont, stay.str(), _ARC_CONTROL);
+						netMove(t, ws2, ws2);
+						netMove(t, netCell(ch, i, _NET_RR_W), \
+							netCell(ch, i, _NET_RR_W));
+						netMove(t, netCell(ch, j, _NET_RR_R), \
+							netCell(ch, j, _NET_RR_R));
+						netProcess(t, cont, src, dest);
+					}
+				} else {
+					
+					first << "_" << i;
+					
+					// reads the cell
+					t = netTransition(cont, a->getLabel() + first.str(), \
+						_ARC_READ);
+					netMove(t, rs2, rs1);
+					netMove(t, netCell(ch, i, _NET_RR_R), \
+						netCell(ch, i, _NET_RR_R));
+					netProcess(t, cont, src, dest);
+					
+					// moves to the cell after the writer, for each cell of
+					// the writer, or to the next one if the writer is not
+					// in it
+					for (k = 0; k < n; k++) {
+						
+						int to = n == _CHANNEL_MIN_CELLS ? (k + 1) % n \
+							: k == j ? i : j;
+						
+						if (n > _CHANNEL_MIN_CELLS && k != j && k != i) {
+							
+							// the same as for k == i
+							continue;
+						}
+						
+						ostringstream label;
+						
+						label << controlLabel("m", ch) << i << to;
+						
+						t = netTransition(cont, label.str(), _ARC_CONTROL);
+						netMove(t, rs1, rs2);
+						netMove(t, netCell(ch, i, _NET_RR_R), \
+							netCell(ch, to, _NET_RR_R));
+						netProcess(t, cont, src, src);
+						
+						if (to != i) {
+							
+							netMove(t, netCell(ch, to, _NET_RR_NOT_R), \
+								netCell(ch, i, _NET_RR_NOT_R));
+						}
+						
+						if (n == _CHANNEL_MIN_CELLS) {
+							
+							netMove(t, netCell(ch, k, _NET_RR_W), \
+								netCell(ch, k, _NET_RR_W));
+						} else if (k == j) {
+							
+							netMove(t, netCell(ch, j, _NET_RR_W), \
+								netCell(ch, j, _NET_RR_W));
+						} else {
+							
+							netMove(t, netCell(ch, j, _NET_RR_NOT_W), \
+								netCell(ch, j, _NET_RR_NOT_W));
+						}
+					}
+				}
 			}
-			
-			_counters[_ACMS_READER_STEP] = \
-				(_counters[_ACMS_READER_STEP] + 1) % 2;
 		}
 	}
-	
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /nextCountersRR()"
-			 << endl;
-	#endif
 }
 
 /**
- * \brief	Checks if a vector state was previously generated.
- * 
- * \fn		int StateGraph::exists(vector<int> succ)
- * \param	succ: the state that is reached when running the process
- * 			<i>proc</i> one step.
- * \return	The position af the state <i>state</i> if it is present in the
- * 			vector <code>All</code> of all generated states.
- * 			<code>_ACMS_NONE</code> otherwise.
- * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	21/09/2004
+ * \brief	Builds the places of an <b>OWBB</b> or <b>OWRRBB</b> channel
+ * 			and the transitions of its IO arcs.
+ * 
+ * \fn		void StateGraph::acm2petrinetOW(int ch)
+ * \param	ch: the position of the channel.
+ * 
+ * Besides the steps and the overwriting bit, each cell <i>c</i> has the
+ * places <code>w</code><i>cs</i> and <code>r</code><i>cs</i>, marked when
+ * the writer or the reader is in its slot <i>s</i>, the complement
+ * <code>nr</code><i>c</i><code>1</code> and the places of the cell in the
+ * last counters: <code>e</code><i>c</i> if it is not there and
+ * <code>f</code><i>cs</i> if it is, with the slot <i>s</i>.
+ * 
+ * The transitions follow <code>nextCountersOW()</code>. The writer only
+ * adds its cell to the last counters, so they always hold the cells just
+ * behind it, one after the other. Then the oldest one is the one whose
+ * previous cell is not there, and the last counters are full when the next
+ * cell of the writer is there, and empty when the reader is just behind
+ * the writer and its cell is not there. The reader jumps to any cell, and
+ * there are events for each pair of (cell,slot) it moves between, so the
+ * net has a number of transitions quadratic in the number of cells, as the
+ * <code>ACM</code> has events.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-int StateGraph::exists(vector<int> succ)
+void StateGraph::acm2petrinetOW(int ch)
 {
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " exists()" << endl;
-	#endif
+	int cont, c2, i, j, s, ns, cell, slot, last, over, t;
+	int n = Channels[ch]->getCells();
+	bool rr = Channels[ch]->getType() == _CHANNEL_OWRRBB;
+	vector<int> c, l;
+	
+	initCounters(ch, c, l);
+	
+	NetBase[ch] = netPlace(controlLabel("wstep", ch) + "1", \
+		c[_ACMS_WRITER_STEP] == _ACMS_STEP_1);
+	netPlace(controlLabel("wstep", ch) + "2", \
+		c[_ACMS_WRITER_STEP] == _ACMS_STEP_2);
+	netPlace(controlLabel("rstep", ch) + "1", \
+		c[_ACMS_READER_STEP] == _ACMS_STEP_1);
+	netPlace(controlLabel("rstep", ch) + "2", \
+		c[_ACMS_READER_STEP] == _ACMS_STEP_2);
+	netPlace(controlLabel("over", ch) + "0", c[_ACMS_OVER] == 0);
+	netPlace(controlLabel("over", ch) + "1", c[_ACMS_OVER] == 1);
+	
+	for (i = 0; i < n; i++) {
+		
+		ostringstream cell0, cell1;
+		
+		cell0 << i << 0;
+		cell1 << i << 1;
+		
+		netPlace(controlLabel("w", ch) + cell0.str(), \
+			c[_ACMS_WRITER_CELL] == i && c[_ACMS_WRITER_SLOT] == 0);
+		netPlace(controlLabel("w", ch) + cell1.str(), \
+			c[_ACMS_WRITER_CELL] == i && c[_ACMS_WRITER_SLOT] == 1);
+		netPlace(controlLabel("r", ch) + cell0.str(), \
+			c[_ACMS_READER_CELL] == i && c[_ACMS_READER_SLOT] == 0);
+		netPlace(controlLabel("r", ch) + cell1.str(), \
+			c[_ACMS_READER_CELL] == i && c[_ACMS_READER_SLOT] == 1);
+		netPlace(controlLabel("nr", ch) + cell1.str(), \
+			c[_ACMS_READER_CELL] != i || c[_ACMS_READER_SLOT] != 1);
+		
+		ostringstream e;
+		
+		e << i;
+		
+		// the last counters are empty at the beginning
+		netPlace(controlLabel("e", ch) + e.str(), true);
+		netPlace(controlLabel("f", ch) + cell0.str(), false);
+		netPlace(controlLabel("f", ch) + cell1.str(), false);
+	}
 	
-	int cont, size;
+	int ws1 = NetBase[ch] + _NET_WRITER_STEP_1;
+	int ws2 = NetBase[ch] + _NET_WRITER_STEP_2;
+	int rs1 = NetBase[ch] + _NET_READER_STEP_1;
+	int rs2 = NetBase[ch] + _NET_READER_STEP_2;
 	
-	size = All.size();
-	for (cont = 0; cont < size; cont++) {
+	for (cont = 0; cont < Processes.size(); cont++) {
 		
-		if (isRRBB == true 
-			&& succ == All[cont] 
-			&& _counters == Counters[cont]) {
+		for (c2 = 0; c2 < Processes[cont]->Arcs.size(); c2++) {
+			
+			Arc *a = Processes[cont]->Arcs[c2];
 			
-			return cont;
-		} else if (isRRBB == false
-					&& succ == All[cont]
-					&& _counters == Counters[cont] 
-					&& _lastcounters == LastCounters[cont]) {
+			if (a->isIO() == false || a->getChannel() != ch) {
+				
+				continue;
+			}
 			
-			return cont;
+			int src = a->getSrc();
+			int dest = a->getDest();
+			
+			for (i = 0; i < n; i++) {
+				
+				for (s = 0; s < 2; s++) {
+					
+					ostringstream first;
+					
+					first << "_" << i << s;
+					
+					if (a->getIOType() == _ARC_WRITE) {
+						
+						// writes the slot
+						t = netTransition(cont, a->getLabel() + first.str(), \
+							_ARC_WRITE);
+						netMove(t, ws1, ws2);
+						netMove(t, netCell(ch, i, _NET_OW_W + s), \
+							netCell(ch, i, _NET_OW_W + s));
+						netProcess(t, cont, src, src);
+						
+						// moves to the slot 1 of the next cell, or to the
+						// slot 0 if the reader is in the slot 1; adds the
+						// cell to the last counters, removing the next one
+						// if they are full
+						j = (i + 1) % n;
+						
+						for (ns = 0; ns < 2; ns++) {
+							
+							ostringstream label;
+							
+							label << controlLabel("l", ch) << i << s << j << ns;
+							
+							for (last = -1; last < 2; last++) {
+								
+								for (over = 0; over < 2; over++) {
+									
+									t = netTransition(cont, label.str(), \
+										_ARC_CONTROL);
+									netMove(t, ws2, ws1);
+									netMove(t, netCell(ch, i, _NET_OW_W + s), \
+										netCell(ch, j, _NET_OW_W + ns));
+									netMove(t, ns == 0 \
+										? netCell(ch, j, _NET_OW_R + 1) \
+										: netCell(ch, j, _NET_OW_NOT_R), \
+										ns == 0 \
+										? netCell(ch, j, _NET_OW_R + 1) \
+										: netCell(ch, j, _NET_OW_NOT_R));
+									netMove(t, netCell(ch, i, _NET_OW_OUT), \
+										netCell(ch, i, _NET_OW_IN + s));
+									netMove(t, last < 0 \
+										? netCell(ch, j, _NET_OW_OUT) \
+										: netCell(ch, j, _NET_OW_IN + last), \
+										netCell(ch, j, _NET_OW_OUT));
+									netMove(t, NetBase[ch] + _NET_OVER_0 + \
+										over, NetBase[ch] + _NET_OVER_1);
+									netProcess(t, cont, src, dest);
+								}
+							}
+						}
+						
+						continue;
+					}
+					
+					// reads the slot
+					t = netTransition(cont, a->getLabel() + first.str(), \
+						_ARC_READ);
+					netMove(t, rs1, rs2);
+					netMove(t, netCell(ch, i, _NET_OW_R + s), \
+						netCell(ch, i, _NET_OW_R + s));
+					netProcess(t, cont, src, src);
+					
+					// moves to the oldest of the last counters
+					for (cell = 0; cell < n; cell++) {
+						
+						for (slot = 0; slot < 2; slot++) {
+							
+							if (rr == false && cell == i && slot == s) {
+								
+								// not a move (see isMove())
+								continue;
+							}
+							
+							ostringstream label;
+							
+							label << controlLabel("m", ch) << i << s << cell \
+								  << slot;
+							
+							for (over = 0; over < 2; over++) {
+								
+								t = netTransition(cont, label.str(), \
+									_ARC_CONTROL);
+								netMove(t, rs2, rs1);
+								netMove(t, netCell(ch, i, _NET_OW_R + s), \
+									netCell(ch, cell, _NET_OW_R + slot));
+								
+								if (cell != i || slot != s) {
+									
+									netMove(t, slot == 1 \
+										? netCell(ch, cell, _NET_OW_NOT_R) \
+										: -1, s == 1 \
+										? netCell(ch, i, _NET_OW_NOT_R) : -1);
+								}
+								
+								netMove(t, netCell(ch, cell, _NET_OW_IN + slot), \
+									netCell(ch, cell, _NET_OW_OUT));
+								netMove(t, \
+									netCell(ch, (cell + n - 1) % n, _NET_OW_OUT), \
+									netCell(ch, (cell + n - 1) % n, _NET_OW_OUT));
+								netMove(t, NetBase[ch] + _NET_OVER_0 + over, \
+									NetBase[ch] + _NET_OVER_0);
+								netProcess(t, cont, src, dest);
+							}
+						}
+					}
+					
+					if (rr == false) {
+						
+						continue;
+					}
+					
+					// the last counters are empty: only the step changes
+					ostringstream label;
+					
+					label << controlLabel("m", ch) << i << s << i << s;
+					
+					for (ns = 0; ns < 2; ns++) {
+						
+						t = netTransition(cont, label.str(), _ARC_CONTROL);
+						netMove(t, rs2, rs1);
+						netMove(t, netCell(ch, i, _NET_OW_R + s), \
+							netCell(ch, i, _NET_OW_R + s));
+						netMove(t, netCell(ch, (i + 1) % n, _NET_OW_W + ns), \
+							netCell(ch, (i + 1) % n, _NET_OW_W + ns));
+						netMove(t, netCell(ch, i, _NET_OW_OUT), \
+							netCell(ch, i, _NET_OW_OUT));
+						netProcess(t, cont, src, dest);
+					}
+				}
+			}
 		}
 	}
-	
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /exists()" << endl;
-	#endif
-	
-	return _ACMS_NONE;
 }
 
 /**
- * \brief	Inserts a new <b>Arc</b> in the process <b>ACM</b>.
+ * \brief	Inserts a place in the Petri net being built.
  * 
- * \fn		void StateGraph::insertArc(int proc, int src, int dest, string lab)
- * \param	proc: target of the process.
- * \param	src: target of the source state in process <i>proc</i>.
- * \param	dest: target of the destination state in process <i>proc</i>.
- * \param	lab: the label of the arc to be created.
+ * \fn		int StateGraph::netPlace(string label, bool marked)
+ * \param	label: the label of the place.
+ * \param	marked: <b>true</b> if the place has a token at the beginning.
+ * \return	The target of the place.
  * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	20/07/2004
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-void StateGraph::insertArc(int proc, int src, int dest, string lab)
+int StateGraph::netPlace(string label, bool marked)
 {
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " insertArc()" << endl;
-	#endif
-	
-	string label;
+	int p = Net->insertPlace(label);
 	
-	label = Processes[proc]->getLabel();
-	label.append(".");
-	label.append(lab);
-					
-	ACM->insertArc(src, label.c_str(), dest);
+	Net->setTokens(p, marked ? 1 : 0);
 	
-	#ifdef _JABUTI_ACMS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /insertArc()" << endl;
-	#endif
+	return p;
 }
 
 /**
- * \brief	Converts an <code>ACM</code> into a <code>PNmodel</code>.
+ * \brief	Gets a place of a cell of a channel in the Petri net being built.
  * 
- * \fn		PNmodel * StateGraph::acm2petrinet(void)
+ * \fn		int StateGraph::netCell(int ch, int cell, int place)
+ * \param	ch: the position of the channel.
+ * \param	cell: the cell.
+ * \param	place: the place in the cell (<code>_NET_RR_W</code>, ...,
+ * 			<code>_NET_OW_W</code>, ...).
+ * \return	The target of the place.
  * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	25/01/2005
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-PNmodel * StateGraph::acm2petrinet(void)
+int StateGraph::netCell(int ch, int cell, int place)
 {
-	switch (ACMChannel->getType()) {
-		
-		case _CHANNEL_RRBB:
-			
-			return acm2petrinetRR();
-			break;
+	if (Channels[ch]->getType() == _CHANNEL_RRBB) {
 		
-		case _CHANNEL_OWBB:
-		case _CHANNEL_OWRRBB:
-			
-			return acm2petrinetOW();
-			break;
+		return NetBase[ch] + _NET_RR_FIRST + cell * _NET_RR_CELL + place;
 	}
+	
+	return NetBase[ch] + _NET_OW_FIRST + cell * _NET_OW_CELL + place;
 }
 
 /**
- * \brief	Converts an <code>ACM</code> into a <code>PNmodel</code>.
+ * \brief	Inserts a transition in the Petri net being built.
  * 
- * \fn		PNmodel * StateGraph::acm2petrinetRR(void)
+ * \fn		int StateGraph::netTransition(int proc, string lab, int type)
+ * \param	proc: the target of the process of the event.
+ * \param	lab: the label of the event, without the process.
+ * \param	type: the IO type of the event, as in <code>insertArc()</code>.
+ * \return	The target of the transition.
  * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	25/01/2005
+ * The first transition of an event is named after it, and the next ones
+ * <code>/1</code>, <code>/2</code>, ... after it, as the instances of
+ * <b>petrify</b>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-PNmodel * StateGraph::acm2petrinetRR(void)
+int StateGraph::netTransition(int proc, string lab, int type)
 {
-	PNmodel *pn = new PNmodel();
+	string label = Processes[proc]->getLabel() + "." + lab;
+	int instance = NetInstances[label]++;
 	
-	int cont, cells, states;
-	string prefix;
-	
-	cells = ACMChannel->getCells();
-	states = Counters.size();
-	
-	for (cont = 0; cont < cells; cont++) {
+	if (instance > 0) {
 		
 		ostringstream saux;
-		saux << cont << flush;
-		
-		prefix = "w!=";
-		prefix.append(saux.str());
-		
-		pn->insertPlace(prefix);
 		
-		if (cont != cells - 1) {
-			
-			pn->setTokens(cont * 2, 1);
-		}
-		
-		prefix = "r!=";
-		prefix.append(saux.str());
+		saux << "/" << instance;
+		label.append(saux.str());
+	}
+	
+	if (type == _ARC_WRITE || type == _ARC_READ) {
 		
-		pn->insertPlace(prefix);
+		return Net->insertTransition(label, _PN_T_INTERNAL);
+	} else if (type == _ARC_CONTROL) {
 		
-		if (cont != 0) {
-			
-			pn->setTokens(cont * 2 + 1, 1);
-		}
+		return Net->insertTransition(label, _PN_T_OUTPUTS);
 	}
 	
-	for (cont = 0; cont < states; cont++) {
-		
+	return Net->insertTransition(label, _PN_T_DUMMY);
+}
+
+/**
+ * \brief	Makes a transition of the Petri net being built move a token.
+ * 
+ * \fn		void StateGraph::netMove(int t, int from, int to)
+ * \param	t: the target of the transition.
+ * \param	from: the place the token is taken from. -1 for none.
+ * \param	to: the place the token is put in. -1 for none.
+ * 
+ * If <i>from</i> and <i>to</i> are the same place, the transition only
+ * reads it: it needs the token but leaves it there.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::netMove(int t, int from, int to)
+{
+	if (from >= 0) {
 		
+		Net->insertArc(from, t, _PN_P);
 	}
 	
-	return pn;
+	if (to >= 0) {
+		
+		Net->insertArc(t, to, _PN_T);
+	}
 }
 
 /**
- * \brief	Converts an <code>ACM</code> into a <code>PNmodel</code>.
+ * \brief	Makes a transition of the Petri net being built move a process.
  * 
- * \fn		PNmodel * StateGraph::acm2petrinetOW(void)
+ * \fn		void StateGraph::netProcess(int t, int proc, int src, int dest)
+ * \param	t: the target of the transition.
+ * \param	proc: the target of the process.
+ * \param	src: the state of the process before the transition.
+ * \param	dest: the state of the process after it.
  * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	25/01/2005
+ * Nothing is done for the processes with only one state.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
  */
-PNmodel * StateGraph::acm2petrinetOW(void)
+void StateGraph::netProcess(int t, int proc, int src, int dest)
 {
-	return NULL;
+	if (NetStates[proc].size() > 0) {
+		
+		netMove(t, NetStates[proc][src], NetStates[proc][dest]);
+	}
 }
 
 /**
@@ -1467,105 +3771,198 @@ PNmodel * StateGraph::acm2petrinetOW(void)
  */
 void StateGraph::acm2petrify(char *cmd[])
 {
-	vector<string> internal = getEvents(_ARC_WRITE);
-	vector<string> outputs = getEvents(_ARC_CONTROL);
-	vector<string> dummy = getEvents(_ARC_NONE);
-
-	time_t rawtime;
-	struct tm * timeinfo;
-
-	time(&rawtime);
-	timeinfo = localtime(&rawtime);
+	if (Stats != NULL) {
+		
+		Stats->begin("output");
+	}
 	
-	// Prints header of the model
-	cout << "# Generated by jabuti " << _acms_version << " (compiled "
-		 << __DATE__ << " at " << __TIME__ << ")" << endl;
-	cout << "#";
+	if (Writer != NULL) {
+		
+		petrifyComments(cmd, Writer->getStates(), Writer->getArcs());
+		
+		cout << ".model " << ACM->getLabel() << endl;
+		
+		petrifyEvents();
+		Writer->writeGraph(cout);
+	} else {
+		
+		petrifyGraph(cmd);
+	}
 	
-	int i = 0;
-	while (cmd[i] != NULL) cout << " " << cmd[i++];
+	if (Stats != NULL) {
+		
+		cout.flush();
+		
+		Stats->end();
+		
+		if (Store.size() > 0) {
+			
+			Stats->summary(getStates(), getArcs(), Store.getLoad(), \
+				Store.getMemory(), SuccessorAllocations);
+		} else {
+			
+			Stats->summary(getStates(), getArcs(), ParallelLoad, \
+				ParallelMemory, SuccessorAllocations);
+		}
+	}
+}
+
+/**
+ * \brief	Writes the <code>ACM</code> in the binary format.
+ * 
+ * \fn		void StateGraph::acm2binary(const char *file)
+ * \param	*file: the name of the file.
+ * 
+ * The format is described in <b>ImageHeader</b> and the file is read back
+ * by <b>ACMImage</b>. The events are numbered in the order they first
+ * appear in the arcs, which is the order of <code>Events</code>, so the
+ * lists of the header of the Petrify format can be rebuilt. The
+ * <code>ACM</code> must be kept in memory (see <code>setStream()</code>).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateGraph::acm2binary(const char *file)
+{
+	int cont, k;
+	int states = ACM->States.size();
+	int arcs = ACM->Arcs.size();
+	ImageHeader header;
+	FILE *f;
 	
-	cout << endl;
-	cout << "# " << asctime(timeinfo);
-	cout << "# ";
-	cout << ACM->States.size() << " states -- ";
-	cout << ACM->Arcs.size() << " arcs" << endl;
+	vector<int> local(Arc::Events.size(), _ARC_NONE);
+	vector<int> first, dest, event, io, channel, cell, slot;
+	vector<int> eclass, eproc, ename, pname;
+	string strings;
 	
-	// Prints information about the model
-	cout << ".model " << ACM->getLabel() << endl;
+	if (Writer != NULL) {
+		
+		Penknife::pkerrors(_ACMS_ERROR_STREAMED, (char *) file);
+		exit(_ACMS_ERROR_CODE_STREAMED);
+	}
+	
+	strings = ACM->getLabel();
+	strings.push_back('\0');
 	
-	// Prints list of INTERNAL events
-	if (internal.size() > 0) {
+	// the events, in the order they first appear
+	for (cont = 0; cont < arcs; cont++) {
 		
-		cout << ".internal";
+		Arc *a = ACM->Arcs[cont];
 		
-		for (int cont = 0; cont < internal.size(); cont++) {
+		if (local[a->getEvent()] != _ARC_NONE) {
 			
-			cout << " " << internal[cont];
+			continue;
 		}
 		
-		cout << endl;
+		local[a->getEvent()] = eclass.size();
+		
+		eclass.push_back(EventIndex::classOf(a->getIOType()));
+		eproc.push_back(_ARC_NONE);
+		ename.push_back(strings.size());
+		
+		strings.append(a->getLabel());
+		strings.push_back('\0');
 	}
-
-	// Prints list of OUTPUTS events
-	if (outputs.size() > 0) {
+	
+	for (cont = 0; cont < Processes.size(); cont++) {
 		
-		cout << ".outputs";
+		vector<int> &events = Events.getProcess(cont);
 		
-		for (int cont = 0; cont < outputs.size(); cont++) {
+		for (k = 0; k < events.size(); k++) {
 			
-			cout << " " << outputs[cont];
+			if (local[events[k]] != _ARC_NONE) {
+				
+				eproc[local[events[k]]] = cont;
+			}
 		}
 		
-		cout << endl;
+		pname.push_back(strings.size());
+		
+		strings.append(Processes[cont]->getLabel());
+		strings.push_back('\0');
 	}
 	
-	// Prints other events
-	if (dummy.size() > 0) {
+	// the arcs, by source
+	for (cont = 0; cont < states; cont++) {
 		
-		cout << ".dummy";
+		const vector<int> &out = ACM->getOutArcs(cont);
 		
-		for (int cont = 0; cont < dummy.size(); cont++) {
+		first.push_back(dest.size());
+		
+		for (k = 0; k < out.size(); k += 2) {
+			
+			Arc *a = ACM->Arcs[out[k]];
 			
-			cout << " " << dummy[cont];
+			dest.push_back(out[k + 1]);
+			event.push_back(local[a->getEvent()]);
+			io.push_back(a->getIOType());
+			channel.push_back(a->getChannel());
+			cell.push_back(a->getOnCell());
+			slot.push_back(a->getOnSlot());
 		}
-		
-		cout << endl;
 	}
 	
-	// Prints process info
-	for (int cont = 0; cont < Processes.size(); cont++) {
+	first.push_back(dest.size());
+	
+	header.magic = _IMAGE_MAGIC;
+	header.version = _IMAGE_VERSION;
+	header.states = states;
+	header.arcs = dest.size();
+	header.events = eclass.size();
+	header.processes = Processes.size();
+	header.init = 0;
+	header.label = 0;
+	header.strings = strings.size();
+	
+	vector<int> *arrays[] = {&first, &dest, &event, &io, &channel, &cell, \
+		&slot, &eclass, &eproc, &ename, &pname};
+	
+	if ((f = fopen(file, "wb")) == NULL) {
 		
-		string prefix = Processes[cont]->getLabel();
-		vector<string> arcs;
-
-		prefix.append(".");
+		Penknife::pkerrors(_ACMS_ERROR_BINARY, (char *) file);
+		exit(_ACMS_ERROR_CODE_BINARY);
+	}
+	
+	fwrite(&header, sizeof(header), 1, f);
+	
+	for (cont = 0; cont < 11; cont++) {
 		
-		cout << ".process " << cont;
-
-		for (int c2 = 0; c2 < ACM->Arcs.size(); c2++) {
+		if (arrays[cont]->size() > 0) {
 			
-			int c3;
-
-			if (ACM->Arcs[c2]->getLabel().find(prefix.c_str(), 0) == 0) {
-				
-				for (c3 = 0; c3 < arcs.size(); c3++) {
-					
-					if (arcs[c3] == ACM->Arcs[c2]->getLabel())
-						break;
-				}
-				
-				if (c3 == arcs.size()) {
-					
-					arcs.insert(arcs.end(), ACM->Arcs[c2]->getLabel());
-					cout << " " << ACM->Arcs[c2]->getLabel();	
-				}
-			}
+			fwrite(&(*arrays[cont])[0], sizeof(int), arrays[cont]->size(), f);
 		}
-
-		cout << endl;
 	}
 	
+	fwrite(strings.data(), 1, strings.size(), f);
+	
+	if (ferror(f) || fclose(f) != 0) {
+		
+		Penknife::pkerrors(_ACMS_ERROR_BINARY, (char *) file);
+		exit(_ACMS_ERROR_CODE_BINARY);
+	}
+}
+
+/**
+ * \brief	Writes the <code>ACM</code> in the Petrify format.
+ * 
+ * \fn		void StateGraph::petrifyGraph(char *cmd[])
+ * \param	*cmd[]: the command line.
+ * 
+ * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
+ * \date	25/01/2005
+ */
+void StateGraph::petrifyGraph(char *cmd[])
+{
+	
+	// Prints header of the model
+	petrifyComments(cmd, ACM->States.size(), ACM->Arcs.size());
+	
+	// Prints information about the model
+	cout << ".model " << ACM->getLabel() << endl;
+	
+	// Prints lists of events and process info
+	petrifyEvents();
+	
 	// Prints State Graph
 	cout << ".state graph" << " # begin state graph" << endl;
 	
@@ -1596,51 +3993,11 @@ void StateGraph::acm2petrify(char *cmd[])
 vector<string> StateGraph::getEvents(int t)
 {
 	vector<string> arcs;
-	int i;
-	int size = ACM->Arcs.size();
-
-	for (int cont = 0; cont < size; cont++) {
+	vector<int> &events = Events.getClass(EventIndex::classOf(t));
+	
+	for (int cont = 0; cont < events.size(); cont++) {
 		
-		if (ACM->Arcs[cont]->getIOType() == _ARC_CONTROL && t == _ARC_CONTROL) {
-			
-			for (i = 0; i < arcs.size(); i++) {
-				
-				if (arcs[i] == ACM->Arcs[cont]->getLabel())
-					break;
-			}
-			
-			if (i == arcs.size()) {
-				
-				arcs.insert(arcs.end(), ACM->Arcs[cont]->getLabel());
-			}
-		} else if ((ACM->Arcs[cont]->getIOType() == _ARC_WRITE
-				||  ACM->Arcs[cont]->getIOType() == _ARC_READ)
-			&& (t == _ARC_WRITE || t == _ARC_READ)) {
-			
-			for (i = 0; i < arcs.size(); i++) {
-				
-				if (arcs[i] == ACM->Arcs[cont]->getLabel())
-					break;
-			}
-			
-			if (i == arcs.size()) {
-				
-				arcs.insert(arcs.end(), ACM->Arcs[cont]->getLabel());
-			}
-		} else if (ACM->Arcs[cont]->getIOType() == _ARC_NONE 
-			&& t == _ARC_NONE) {
-			
-			for (i = 0; i < arcs.size(); i++) {
-				
-				if (arcs[i] == ACM->Arcs[cont]->getLabel())
-					break;
-			}
-			
-			if (i == arcs.size()) {
-				
-				arcs.insert(arcs.end(), ACM->Arcs[cont]->getLabel());
-			}
-		}
+		arcs.push_back(Arc::Events.getLabel(events[cont]));
 	}
 	
 	return arcs;
@@ -27,12 +27,24 @@ using namespace std;
 
 #include "config.h"
 
+#include "ACMImage.h"
+#include "Allocations.h"
 #include "Channel.h"
+#include "EventIndex.h"
+#include "ExplorationStats.h"
 #include "Process.h"
+#include "PetrifyWriter.h"
 #include "PNmodel.h"
+#include "RunSorter.h"
+#include "SharedStore.h"
+#include "StateStore.h"
+#include "WorkPool.h"
 
 //#include <iostream>
 //#include <sstream>
+#include <atomic>
+#include <deque>
+#include <map>
 #include <string>
 #include <vector>
 //
@@ -87,6 +99,91 @@ using namespace std;
 /** Defines the number of the third part of an IO oparation. */
 #define _ACMS_STEP_3						2
 
+/** Default number of threads used to generate the state space. */
+#define _ACMS_THREADS						1
+
+/** The state space is explored without symmetry reduction. */
+#define _ACMS_SYMMETRY_NONE					0
+
+/** Only one state of each orbit under the rotation of the cells is
+ *  explored, and the <code>ACM</code> is the quotient graph. */
+#define _ACMS_SYMMETRY_QUOTIENT				1
+
+/** Only one state of each orbit under the rotation of the cells is
+ *  explored, and the quotient graph is expanded back to the full
+ *  <code>ACM</code>. */
+#define _ACMS_SYMMETRY_EXPAND				2
+
+/** Default number of bytes of memory used by the external generation of
+ *  the state space. */
+#define _ACMS_EXTERNAL_MEMORY				(256L << 20)
+
+/** Maximum number of recent states remembered by the external generation
+ *  of the state space. */
+#define _ACMS_EXTERNAL_CACHE				(1 << 20)
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PLACES OF A CHANNEL IN THE PETRI NET (see acm2petrinet())
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** The place of the writer in the first part of an IO operation. */
+#define _NET_WRITER_STEP_1					0
+
+/** The place of the writer in the second part of an IO operation. */
+#define _NET_WRITER_STEP_2					1
+
+/** The place of the reader in the first part of an IO operation. */
+#define _NET_READER_STEP_1					2
+
+/** The place of the reader in the second part of an IO operation. */
+#define _NET_READER_STEP_2					3
+
+/** The place of the <b>overwriting</b> bit cleared (<b>OW</b> policies). */
+#define _NET_OVER_0							4
+
+/** The place of the <b>overwriting</b> bit set (<b>OW</b> policies). */
+#define _NET_OVER_1							5
+
+/** The places of a <b>RRBB</b> channel before the ones of the cells. */
+#define _NET_RR_FIRST						4
+
+/** The places of an <b>OW</b> channel before the ones of the cells. */
+#define _NET_OW_FIRST						6
+
+/** <b>RRBB</b>: the place of the writer in a cell. */
+#define _NET_RR_W							0
+
+/** <b>RRBB</b>: the place of the writer not in a cell. */
+#define _NET_RR_NOT_W						1
+
+/** <b>RRBB</b>: the place of the reader in a cell. */
+#define _NET_RR_R							2
+
+/** <b>RRBB</b>: the place of the reader not in a cell. */
+#define _NET_RR_NOT_R						3
+
+/** <b>RRBB</b>: the number of places of each cell. */
+#define _NET_RR_CELL						4
+
+/** <b>OW</b>: the places of the writer in a cell, one for each slot. */
+#define _NET_OW_W							0
+
+/** <b>OW</b>: the places of the reader in a cell, one for each slot. */
+#define _NET_OW_R							2
+
+/** <b>OW</b>: the place of the reader not in the slot 1 of a cell. */
+#define _NET_OW_NOT_R						4
+
+/** <b>OW</b>: the place of a cell not in the last counters. */
+#define _NET_OW_OUT							5
+
+/** <b>OW</b>: the places of a cell in the last counters, one for each
+ *  slot. */
+#define _NET_OW_IN							6
+
+/** <b>OW</b>: the number of places of each cell. */
+#define _NET_OW_CELL						8
+
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * ERRORS MESSAGE
  * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
@@ -94,6 +191,12 @@ using namespace std;
 /** Message error: policy not implemented. */
 #define _ACMS_ERROR_POL_N_IMPLEMENTED		"policy not implemented"
 
+/** Message error: the ACM is not kept in memory. */
+#define _ACMS_ERROR_STREAMED				"the ACM is not kept in memory"
+
+/** Message error: the binary ACM file could not be written. */
+#define _ACMS_ERROR_BINARY					"could not write binary ACM file"
+
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * CODE ERRORS
  * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
@@ -101,6 +204,12 @@ using namespace std;
 /** Error code: policy not implemented. */
 #define _ACMS_ERROR_CODE_POL_N_IMPLEMENTED	30
 
+/** Error code: the ACM is not kept in memory. */
+#define _ACMS_ERROR_CODE_STREAMED			36
+
+/** Error code: the binary ACM file could not be written. */
+#define _ACMS_ERROR_CODE_BINARY				37
+
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * STRINGS FOR PETRIFY MODEL
  * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
@@ -108,6 +217,97 @@ using namespace std;
 /** jabuti version text.*/
 #define _acms_version						"0.4.2"
 
+/**
+ * \struct	ExplorationThread StateGraph.h
+ * \brief	The data of a thread of the generation of the state space.
+ * 
+ * The vectors are scratch buffers owned by the thread: the successors of a
+ * state are generated into them one by one (see
+ * <code>StateGraph::nextSuccessor()</code>), so once they are reserved (see
+ * <code>StateGraph::reserveScratch()</code>) no memory is allocated per
+ * transition. The sequential generation uses one of them too.
+ * 
+ * The counters are the ones of one channel: the channel of the arc that
+ * runs to reach the successor.
+ * 
+ * Besides its working vectors, each thread of the parallel generation
+ * records the states it expanded and the arcs leaving them, so the
+ * <code>ACM</code> can be built later always in the same order (see
+ * <code>StateGraph::generateStateSpaceParallel()</code>).
+ */
+struct ExplorationThread {
+	
+	/** The fields of the state being expanded (see
+	 *  <code>StateGraph::setStateLayout()</code>). The first ones are the
+	 *  states of the processes. */
+	vector<int> state;
+	
+	/** The counters of the state being expanded. Depending on the
+	 * policy, each element of <code>current</code> will a different
+	 * information.
+	 * 
+	 * - <b>RRBB (message)</b>, <b>OWBB (signal)</b> and
+	 *   <b>OWRRBB (pool)</b>:
+	 * 	-#	<code>current[0]</code>: contains the cell
+	 *		counter for the writer.
+	 *	-#	<code>current[1]</code>: contains the cell
+	 *		counter for the reader.
+	 *	-#	<code>current[2]</code>: contains an
+	 *		indication to the step performed in the write operation. Maybe 
+	 * 		<code>_ACMS_STEP_1</code> or <code>_ACMS_STEP_2</code>.
+	 *	-#	<code>current[3]</code>: contains an
+	 *		indication to the step performed in the read operation. Maybe 
+	 * 		<code>_ACMS_STEP_1</code> or <code>_ACMS_STEP_2</code>.
+	 * - <b>OWBB</b> and <b>OWRRBB</b>:
+	 * 	-#	<code>current[4]</code>: contains the slot
+	 *		counter for the writer.
+	 * 	-#	<code>current[5]</code>: contains the slot
+	 *		counter for the reader.
+	 *  -#  <code>current[6]</code>: indicates if writer is in an
+	 * 		overwriting loop.
+	 */
+	vector<int> current;
+	
+	/** The pairs (cell,slot) of the state being expanded that has not
+	 *  been read by the reader. */
+	vector<int> currentlast;
+	
+	/** The counters of the successor. */
+	vector<int> counters;
+	
+	/** The last counters of the successor. */
+	vector<int> lastcounters;
+	
+	/** The fields of the successor. */
+	vector<int> fields;
+	
+	/** The process that runs to reach the successor. */
+	int proc;
+	
+	/** The arc of <code>proc</code> that runs to reach the successor. */
+	int arc;
+	
+	/** The position of the next arc to try in the arcs leaving the state
+	 *  of <code>proc</code>. */
+	int next;
+	
+	/** The process after the last one whose arcs are tried. All of them
+	 *  but when the successors are an ample set (see
+	 *  <code>ampleSet()</code>). */
+	int lastproc;
+	
+	/** The number of allocations done while generating successors. */
+	long allocations;
+	
+	/** The arcs found, as triples (process, arc of the process, handle of
+	 *  the successor). */
+	vector<int> Arcs;
+	
+	/** The states expanded, as triples (handle of the state, position of
+	 *  its first arc in <code>Arcs</code>, number of arcs). */
+	vector<int> Expanded;
+};
+
 /**
  * \class	StateGraph StateGraph.h
  * \brief	The <b>StateGraph</b> class.
@@ -127,27 +327,54 @@ class StateGraph {
 		 * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
 		
 		StateGraph(Channel *ch, vector<Process *> proc);
+		StateGraph(vector<Channel *> ch, vector<Process *> proc);
 		StateGraph(int policy, int size);
 		StateGraph();
 		~StateGraph();
 		
-		Process getACM();
+		Process * getACM();
 		Channel* getChannel();
+		vector<Channel *> getChannels();
 		vector<Process *> getProcesses();
 		
 		void setChannel(Channel *ch);
+		void setChannels(vector<Channel *> ch);
 		void setProcesses(vector<Process *> proc);
 		
+		int getThreads();
+		void setThreads(int n);
+		
+		bool getStream();
+		void setStream(bool s);
+		
+		void setStats(const char *file);
+		
+		int getSymmetry();
+		void setSymmetry(int s);
+		
+		bool getReduction();
+		void setReduction(bool r);
+		
+		bool getExternal();
+		void setExternal(const char *dir, long memory);
+		
+		long getSuccessorAllocations();
+		int getStates();
+		int getArcs();
+		
 		void makeACM();
 		
 		void acm2petrify(char *cmd[]);
+		void acm2binary(const char *file);
 		PNmodel * acm2petrinet(void);
-		PNmodel * acm2petrinetRR(void);
-		PNmodel * acm2petrinetOW(void);
 		vector<string> getEvents(int t);
 		
 		void reset();
 		
+		static void petrifyComments(char *cmd[], int states, int arcs);
+		static void petrinetComments(char *cmd[], int places,
+															int transitions);
+		
 	private:
 		
 		/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -157,78 +384,190 @@ class StateGraph {
 		/** To store the result of the synthesis algorithms. */
 		Process *ACM;
 		
-		/** The communication channel of the system. */
+		/** The first communication channel of the system. */
 		Channel *ACMChannel;
 		
-		/** To control the states (slots information) that have been generated.
-		 * Depending on the policy, each element of <code>Counters</code> will
-		 * a different information.
-		 * 
-		 * - <b>RRBB (message)</b>, <b>OWBB (signal)</b> and
-		 *   <b>OWRRBB (pool)</b>:
-		 * 	-#	<code>Counters[state][0]</code>: contains the cell
-		 *		counter for the writer.
-		 *	-#	<code>Counters[state][1]</code>: contains the cell
-		 *		counter for the reader.
-		 *	-#	<code>Counters[state][2]</code>: contains an
-		 *		indication to the step performed in the write operation. Maybe 
-		 * 		<code>_ACMS_STEP_1</code> or <code>_ACMS_STEP_2</code>.
-		 *	-#	<code>Counters[state][3]</code>: contains an
-		 *		indication to the step performed in the read operation. Maybe 
-		 * 		<code>_ACMS_STEP_1</code> or <code>_ACMS_STEP_2</code>.
-		 * - <b>OWBB</b> and <b>OWRRBB</b>:
-		 * 	-#	<code>Counters[state][4]</code>: contains the slot
-		 *		counter for the writer.
-		 * 	-#	<code>Counters[state][5]</code>: contains the slot
-		 *		counter for the reader.
-		 *  -#  <code>Counters[state][6]</code>: indicates if writer is in an
-		 * 		overwriting loop.
-		 */
-		vector<vector<int> > Counters;
-		
-		/** The vector with the pairs (cell,slot) that has not been read by
-		 *  the reader */
-		vector<vector<int> > LastCounters;
-		
-		/** This is an auxiliary vector to avoid using many memory. */
-		vector<int> _counters;
-		
-		/** This is an auxiliary vector to avoid using many memory. */
-		vector<int> _lastcounters;
+		/** The communication channels of the system. The channel of an IO
+		 *  arc is its position in this vector. */
+		vector<Channel *> Channels;
+		
+		/** The generated states. Each state is stored packed (see
+		 *  <code>setStateLayout()</code>) and is identified by its position
+		 *  in the store, which is also its target in <code>ACM</code>. */
+		StateStore Store;
+		
+		/** The scratch buffers of the sequential generation. Also used to
+		 *  build the labels of the arcs (see <code>createNewArc()</code>):
+		 *  <code>current</code> has the counters of the source state and
+		 *  <code>counters</code> the ones of the destination state. */
+		ExplorationThread Scratch;
+		
+		/** The number of allocations done while generating successors (see
+		 *  <code>nextSuccessor()</code>). */
+		long SuccessorAllocations;
+		
+		/** Maximum number of pairs (cell,slot) in the last counters of
+		 *  each channel. */
+		vector<int> Pairs;
+		
+		/** The position of the first field of each channel in a state (see
+		 *  <code>setStateLayout()</code>). */
+		vector<int> ChannelBase;
+		
+		/** The largest element of <code>Pairs</code>. */
+		int _pairs;
+		
+		/** The width in bits of each field of a state (see
+		 *  <code>setStateLayout()</code>). */
+		vector<int> Layout;
+		
+		/** Number of threads used to generate the state space. */
+		int Threads;
+		
+		/** The symmetry reduction used to generate the state space (see
+		 *  <code>setSymmetry()</code>). */
+		int Symmetry;
+		
+		/** If the partial order reduction is used to generate the state
+		 *  space (see <code>setReduction()</code>). */
+		bool Reduction;
+		
+		/** If the state space is generated in external memory (see
+		 *  <code>setExternal()</code>). */
+		bool External;
+		
+		/** The directory of the scratch files of the external generation.
+		 *  <code>NULL</code> for the one of <code>tmpfile()</code>. */
+		const char *ExternalDir;
+		
+		/** The number of bytes of memory used by the external generation. */
+		long ExternalMemory;
+		
+		/** The recent states of the external generation, whose numbers are
+		 *  in <code>RecentIds</code>. */
+		StateStore Recent;
+		
+		/** The number of each state of <code>Recent</code>. */
+		vector<int> RecentIds;
+		
+		/** The event of the last arc found by the external generation (see
+		 *  <code>insertArc()</code>). */
+		int ExternalEvent;
+		
+		/** The arcs of the quotient graph, as quadruples (process, arc of
+		 *  the process, representative of the successor, rotation applied
+		 *  to the channel of the arc of the successor to get its
+		 *  representative). Only kept when the quotient is expanded (see
+		 *  <code>expandQuotient()</code>). */
+		vector<int> Quotient;
+		
+		/** The position in <code>Quotient</code> of the first arc of each
+		 *  representative. */
+		vector<int> QuotientFirst;
+		
+		/** The events of the arcs of the state graph, by class and by
+		 *  process. Updated by <code>insertArc()</code>. */
+		EventIndex Events;
+		
+		/** Writes the state graph while it is generated. <code>NULL</code>
+		 *  if it is not streamed (see <code>setStream()</code>). */
+		PetrifyWriter *Writer;
+		
+		/** Reports the progress of the generation. <code>NULL</code> if
+		 *  it is not reported (see <code>setStats()</code>). */
+		ExplorationStats *Stats;
+		
+		/** The number of arcs found by the threads so far. Only counted
+		 *  when the progress is reported (see <code>exploreThread()</code>). */
+		atomic<long> ParallelArcs;
+		
+		/** The load and memory of the states found by the threads, for the
+		 *  summary when they are not copied to <code>Store</code> (see
+		 *  <code>replaySuccessors()</code>). */
+		double ParallelLoad;
+		long ParallelMemory;
 		
 		/** Vector with all processes of the system. */
 		vector<Process *> Processes;
 		
 		/** To control the states that have not been processed (yet). */
-		vector<int> New;
+		deque<int> New;
+		
+		/** The Petri net being built by <code>acm2petrinet()</code>. */
+		PNmodel *Net;
+		
+		/** The number of transitions of <code>Net</code> with each event,
+		 *  to name the next one (see <code>netTransition()</code>). */
+		map<string, int> NetInstances;
+		
+		/** The place of each state of each process in <code>Net</code>.
+		 *  Empty for the processes with only one state. */
+		vector<vector<int> > NetStates;
 		
-		/** To control the states that have been generated. */
-		vector<vector<int> > All;
+		/** The first place of each channel in <code>Net</code>. */
+		vector<int> NetBase;
 		
-		/** To be used in the choose of the correct exists() method. */
-		bool isRRBB;
-				
 		/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 		 * Private methods prototypes.
 		 * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
 		
 		void createInitState();
+		void initState(vector<int> &fields);
+		void initCounters(int ch, vector<int> &c, vector<int> &l);
 		void generateStateSpace();
+		void generateStateSpaceParallel();
+		void replaySuccessors(SharedStore *shared, int init);
+		void generateStateSpaceSymmetric();
+		void generateStateSpaceExternal();
+		void expandLayer(FILE *layer, int first, int last, RunSorter &found,
+															RunSorter &resolved);
+		FILE * numberLayer(FILE *visited, RunSorter &found, RunSorter &resolved,
+															FILE *layer);
+		FILE * openScratch();
+		void flushScratch(FILE *f);
+		void expandQuotient();
+		int canonicalRotation(vector<int> &fields, int ch);
+		void rotateChannel(vector<int> &fields, int ch, int k);
+		void exploreThread(int thread, WorkPool *pool, SharedStore *shared,
+													ExplorationThread *data);
 		void generateSuccessors(int state);
-		void createNewState(int proc, int arc, int state, 
-															vector<int> succ);
-		void createNewStateOW(int proc, int arc, int state, 
-															vector<int> succ);
-		void createNewStateRR(int proc, int arc, int state, 
-															vector<int> succ);
+		bool ampleSet(ExplorationThread *data);
+		void reserveScratch(ExplorationThread *data);
+		void firstSuccessor(ExplorationThread *data);
+		bool nextSuccessor(ExplorationThread *data);
+		void createNewState(int proc, int arc, int state);
 		void createNewArc(int proc, int arc, int state, int succ);
 		void createNewArcOW(int proc, int arc, int state, int succ);
 		void createNewArcRR(int proc, int arc, int state, int succ);
-		int nextState(int state, int proc, int pcurr, int arc, int psucc);
-		void nextCounters(int proc, int arc, int state);
-		void nextCountersOW(int proc, int arc, int state);
-		void nextCountersRR(int proc, int arc, int state);
-		int exists(vector<int> succ);
+		int nextState(vector<int> &cur, int proc, int pcurr, int arc, 
+																	int psucc);
+		void nextCounters(int proc, int arc, vector<int> &cur, 
+							vector<int> &curlast, vector<int> &c, vector<int> &l);
+		void nextCountersOW(int proc, int arc, vector<int> &cur, 
+							vector<int> &curlast, vector<int> &c, vector<int> &l);
+		void nextCountersRR(int proc, int arc, vector<int> &cur, 
+							vector<int> &curlast, vector<int> &c, vector<int> &l);
+		bool isMove(int proc, int arc, vector<int> &cur, vector<int> &c);
+		void setStateLayout();
+		void encodeChannel(int ch, vector<int> &c, vector<int> &l,
+														vector<int> &fields);
+		void decodeState(int state);
+		void splitChannel(vector<int> &fields, int ch, vector<int> &c,
+														vector<int> &l);
+		string controlLabel(const char *prefix, int ch);
 		void insertArc(int proc, int src, int dest, string lab);
+		void insertArc(int proc, int src, int dest, string lab, int type,
+												int ch, int cell, int slot);
+		int newState();
+		void acm2petrinetRR(int ch);
+		void acm2petrinetOW(int ch);
+		int netPlace(string label, bool marked);
+		int netCell(int ch, int cell, int place);
+		int netTransition(int proc, string lab, int type);
+		void netMove(int t, int from, int to);
+		void netProcess(int t, int proc, int src, int dest);
+		static void petrifyHeader(char *cmd[]);
+		void petrifyEvents();
+		void petrifyGraph(char *cmd[]);
 };
 #endif /* STATEGRAPH_H */
@@ -0,0 +1,447 @@
+/**
+ * \file		acms/StateStore.cpp
+ * \brief		The methods of the <b>StateStore</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "StateStore.h"
+
+#include <iostream>
+
+#include <string.h>
+
+#include "assert.h"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new empty <b>StateStore</b> element.
+ *
+ * \fn		StateStore::StateStore()
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+StateStore::StateStore()
+{
+	bytes = 0;
+	count = 0;
+}
+
+/**
+ * \brief	Class destructor.
+ *
+ * \fn		StateStore::~StateStore()
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+StateStore::~StateStore()
+{}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Sets the layout of the states and empties the store.
+ *
+ * \fn		void StateStore::setFields(const vector<int> &bits)
+ * \param	bits: the width in bits of each field of a state. A field of width
+ * 			zero always holds the value zero.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateStore::setFields(const vector<int> &bits)
+{
+	int offset = 0;
+
+	Bits = bits;
+	Offsets.clear();
+
+	for (int cont = 0; cont < Bits.size(); cont++) {
+
+		Offsets.push_back(offset);
+		offset += Bits[cont];
+	}
+
+	bytes = (offset + 7) / 8;
+
+	if (bytes == 0) {
+
+		bytes = 1;
+	}
+
+	_packed.assign(bytes, 0);
+
+	clear();
+}
+
+/**
+ * \brief	Removes all the states from the store.
+ *
+ * \fn		void StateStore::clear()
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateStore::clear()
+{
+	count = 0;
+	Arena.clear();
+	Table.assign(_STORE_INIT_TABLE, _STORE_EMPTY);
+}
+
+/**
+ * \brief	Gets the number of fields of a state.
+ *
+ * \fn		int StateStore::getFields()
+ * \return	The number of fields of a state.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateStore::getFields()
+{
+	return Bits.size();
+}
+
+/**
+ * \brief	Gets the size of a packed state.
+ *
+ * \fn		int StateStore::getBytes()
+ * \return	The number of bytes used to store a state.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateStore::getBytes()
+{
+	return bytes;
+}
+
+/**
+ * \brief	Gets the number of stored states.
+ *
+ * \fn		int StateStore::size()
+ * \return	The number of states in the store.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateStore::size()
+{
+	return count;
+}
+
+/**
+ * \brief	Gets the load factor of the hash table.
+ *
+ * \fn		double StateStore::getLoad()
+ * \return	The number of stored states divided by the number of slots.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+double StateStore::getLoad()
+{
+	return Table.size() > 0 ? (double) count / Table.size() : 0;
+}
+
+/**
+ * \brief	Gets the memory reserved by the store.
+ *
+ * \fn		long StateStore::getMemory()
+ * \return	The number of bytes reserved for the arena and the hash table.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+long StateStore::getMemory()
+{
+	return Arena.capacity() + Table.capacity() * sizeof(int);
+}
+
+/**
+ * \brief	Looks for a state in the store.
+ *
+ * \fn		int StateStore::find(const vector<int> &v)
+ * \param	v: the fields of the state.
+ * \return	The position of the state if it was stored before.
+ * 			<code>_STORE_NONE</code> otherwise.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateStore::find(const vector<int> &v)
+{
+	pack(v, &_packed[0]);
+
+	int slot = lookup(&_packed[0], hash(&_packed[0]));
+
+	if (Table[slot] == _STORE_EMPTY) {
+
+		return _STORE_NONE;
+	}
+
+	return Table[slot];
+}
+
+/**
+ * \brief	Inserts a state in the store.
+ *
+ * \fn		int StateStore::insert(const vector<int> &v)
+ * \param	v: the fields of the state.
+ * \return	The position of the state. If the state was already stored, its
+ * 			old position is returned and nothing is inserted.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateStore::insert(const vector<int> &v)
+{
+	pack(v, &_packed[0]);
+
+	unsigned int h = hash(&_packed[0]);
+	int slot = lookup(&_packed[0], h);
+
+	if (Table[slot] != _STORE_EMPTY) {
+
+		return Table[slot];
+	}
+
+	Arena.insert(Arena.end(), _packed.begin(), _packed.end());
+	Table[slot] = count;
+	count++;
+
+	// keeps the load factor of the table below 1/2
+	if (2 * count > Table.size()) {
+
+		grow();
+	}
+
+	return count - 1;
+}
+
+/**
+ * \brief	Unpacks a stored state.
+ *
+ * \fn		void StateStore::get(int id, vector<int> &v)
+ * \param	id: the position of the state.
+ * \param	v: vector where the fields of the state are written.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateStore::get(int id, vector<int> &v)
+{
+	assert(id >= 0 && id < count);
+
+	unpack(&Arena[(size_t)id * bytes], v);
+}
+
+/**
+ * \brief	Gets the packed form of a stored state.
+ *
+ * \fn		const unsigned char * StateStore::get(int id)
+ * \param	id: the position of the state.
+ * \return	A pointer to the <code>getBytes()</code> bytes of the state.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const unsigned char * StateStore::get(int id)
+{
+	assert(id >= 0 && id < count);
+
+	return &Arena[(size_t)id * bytes];
+}
+
+/**
+ * \brief	Packs the fields of a state.
+ *
+ * \fn		void StateStore::pack(const vector<int> &v, unsigned char *dest)
+ * \param	v: the fields of the state.
+ * \param	*dest: where the <code>bytes</code> bytes of the packed state are
+ * 			written.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateStore::pack(const vector<int> &v, unsigned char *dest)
+{
+	int size = Bits.size();
+
+	assert(v.size() == size);
+
+	memset(dest, 0, bytes);
+
+	for (int cont = 0; cont < size; cont++) {
+
+		int value = v[cont];
+		int offset = Offsets[cont];
+
+		assert(value >= 0 && value < (1 << Bits[cont]));
+
+		for (int b = 0; b < Bits[cont]; b++, offset++) {
+
+			if (value & (1 << b)) {
+
+				dest[offset >> 3] |= 1 << (offset & 7);
+			}
+		}
+	}
+}
+
+/**
+ * \brief	Unpacks the fields of a state.
+ *
+ * \fn		void StateStore::unpack(const unsigned char *p, vector<int> &v)
+ * \param	*p: the <code>bytes</code> bytes of the packed state.
+ * \param	v: vector where the fields of the state are written.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateStore::unpack(const unsigned char *p, vector<int> &v)
+{
+	int size = Bits.size();
+
+	v.resize(size);
+
+	for (int cont = 0; cont < size; cont++) {
+
+		int value = 0;
+		int offset = Offsets[cont];
+
+		for (int b = 0; b < Bits[cont]; b++, offset++) {
+
+			if (p[offset >> 3] & (1 << (offset & 7))) {
+
+				value |= 1 << b;
+			}
+		}
+
+		v[cont] = value;
+	}
+}
+
+/**
+ * \brief	Computes the width of a field.
+ *
+ * \fn		int StateStore::bitsFor(int n)
+ * \param	n: the number of different values of the field (from 0 to
+ * 			<i>n</i> - 1).
+ * \return	The number of bits needed to store the field.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateStore::bitsFor(int n)
+{
+	int bits = 0;
+
+	while ((1 << bits) < n) {
+
+		bits++;
+	}
+
+	return bits;
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PRIVATE METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Hash function of the packed states (FNV-1a).
+ *
+ * \fn		unsigned int StateStore::hash(const unsigned char *p)
+ * \param	*p: the packed state.
+ * \return	The hash value of the state.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+unsigned int StateStore::hash(const unsigned char *p)
+{
+	unsigned int h = 2166136261U;
+
+	for (int cont = 0; cont < bytes; cont++) {
+
+		h ^= p[cont];
+		h *= 16777619U;
+	}
+
+	return h;
+}
+
+/**
+ * \brief	Finds the entry of the hash table of a packed state.
+ *
+ * \fn		int StateStore::lookup(const unsigned char *p, unsigned int h)
+ * \param	*p: the packed state.
+ * \param	h: the hash value of <i>*p</i>.
+ * \return	The entry holding the state, or the empty entry where it should
+ * 			be inserted.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int StateStore::lookup(const unsigned char *p, unsigned int h)
+{
+	unsigned int mask = Table.size() - 1;
+	unsigned int slot = h & mask;
+
+	while (Table[slot] != _STORE_EMPTY
+		&& memcmp(&Arena[(size_t)Table[slot] * bytes], p, bytes) != 0) {
+
+		slot = (slot + 1) & mask;
+	}
+
+	return slot;
+}
+
+/**
+ * \brief	Doubles the size of the hash table.
+ *
+ * \fn		void StateStore::grow()
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void StateStore::grow()
+{
+	Table.assign(Table.size() * 2, _STORE_EMPTY);
+
+	for (int cont = 0; cont < count; cont++) {
+
+		const unsigned char *p = &Arena[(size_t)cont * bytes];
+
+		Table[lookup(p, hash(p))] = cont;
+	}
+}
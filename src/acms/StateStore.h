@@ -0,0 +1,115 @@
+/**
+ * \file		acms/StateStore.h
+ * \brief		The definition of the <b>StateStore</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include <vector>
+
+#ifndef STATESTORE_H
+#define STATESTORE_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFINES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Returned when a state is not present in the store. */
+#define _STORE_NONE							-10
+
+/** Marks an empty entry of the hash table. */
+#define _STORE_EMPTY						-1
+
+/** Initial number of entries of the hash table. Must be a power of two. */
+#define _STORE_INIT_TABLE					1024
+
+/**
+ * \class	StateStore StateStore.h
+ * \brief	The <b>StateStore</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ *
+ * The <b>StateStore</b> class. An object of this type keeps the states
+ * generated by the exploration of the state space. Each state is a vector of
+ * fields (integers) whose widths in bits are fixed when the store is set up.
+ * The fields are bit-packed into a string of <code>getBytes()</code> bytes,
+ * all the strings are kept one after the other in a single arena, and an
+ * open addressing hash table indexes them. So a state costs a few bytes and
+ * comparing two states is a <code>memcmp()</code>.
+ */
+class StateStore {
+
+	public:
+
+		StateStore();
+		~StateStore();
+
+		void setFields(const vector<int> &bits);
+		void clear();
+
+		int getFields();
+		int getBytes();
+		int size();
+		double getLoad();
+		long getMemory();
+
+		int find(const vector<int> &v);
+		int insert(const vector<int> &v);
+		void get(int id, vector<int> &v);
+		const unsigned char * get(int id);
+
+		void pack(const vector<int> &v, unsigned char *dest);
+		void unpack(const unsigned char *p, vector<int> &v);
+
+		static int bitsFor(int n);
+
+	private:
+
+		/** Width in bits of each field. */
+		vector<int> Bits;
+
+		/** Position (in bits) of each field in a packed state. */
+		vector<int> Offsets;
+
+		/** Number of bytes of a packed state. */
+		int bytes;
+
+		/** Number of stored states. */
+		int count;
+
+		/** The packed states, <code>bytes</code> bytes each. */
+		vector<unsigned char> Arena;
+
+		/** Open addressing hash table with the positions of the states. */
+		vector<int> Table;
+
+		/** This is an auxiliary vector to avoid using many memory. */
+		vector<unsigned char> _packed;
+
+		unsigned int hash(const unsigned char *p);
+		int lookup(const unsigned char *p, unsigned int h);
+		void grow();
+};
+#endif /* STATESTORE_H */
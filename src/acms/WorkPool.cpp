@@ -0,0 +1,278 @@
+/**
+ * \file		acms/WorkPool.cpp
+ * \brief		The methods of the <b>WorkPool</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "WorkPool.h"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new empty <b>WorkPool</b> element.
+ * 
+ * \fn		WorkPool::WorkPool(int threads)
+ * \param	threads: the number of threads using the pool.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+WorkPool::WorkPool(int threads)
+{
+	for (int cont = 0; cont < threads; cont++) {
+		
+		Queues.push_back(new deque<int>());
+		Locks.push_back(new mutex());
+	}
+	
+	pending = 0;
+	queued = 0;
+	idle = 0;
+}
+
+/**
+ * \brief	Class destructor.
+ * 
+ * \fn		WorkPool::~WorkPool()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+WorkPool::~WorkPool()
+{
+	for (int cont = 0; cont < Queues.size(); cont++) {
+		
+		delete Queues[cont];
+		delete Locks[cont];
+	}
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Adds an item to the queue of a thread.
+ * 
+ * \fn		void WorkPool::push(int thread, int item)
+ * \param	thread: the thread.
+ * \param	item: the item.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void WorkPool::push(int thread, int item)
+{
+	pending++;
+	
+	Locks[thread]->lock();
+	Queues[thread]->push_back(item);
+	Locks[thread]->unlock();
+	
+	queued++;
+	
+	if (idle > 0) {
+		
+		wake(false);
+	}
+}
+
+/**
+ * \brief	Takes an item to be processed by a thread.
+ * 
+ * \fn		bool WorkPool::pop(int thread, int &item)
+ * \param	thread: the thread.
+ * \param	item: where the item is stored.
+ * \return	<b>true</b> if some item was found, in the queue of
+ * 			<i>thread</i> or in the queue of other thread. <b>false</b>
+ * 			otherwise.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool WorkPool::pop(int thread, int &item)
+{
+	int size = Queues.size();
+	
+	Locks[thread]->lock();
+	
+	if (Queues[thread]->empty() == false) {
+		
+		item = Queues[thread]->back();
+		Queues[thread]->pop_back();
+		Locks[thread]->unlock();
+		
+		queued--;
+		
+		return true;
+	}
+	
+	Locks[thread]->unlock();
+	
+	for (int cont = 1; cont < size; cont++) {
+		
+		int victim = (thread + cont) % size;
+		
+		Locks[victim]->lock();
+		
+		if (Queues[victim]->empty() == false) {
+			
+			item = Queues[victim]->front();
+			Queues[victim]->pop_front();
+			Locks[victim]->unlock();
+			
+			queued--;
+			
+			return true;
+		}
+		
+		Locks[victim]->unlock();
+	}
+	
+	return false;
+}
+
+/**
+ * \brief	Takes an item to be processed by a thread, waiting for one if
+ * 			there is none.
+ * 
+ * \fn		bool WorkPool::take(int thread, int &item)
+ * \param	thread: the thread.
+ * \param	item: where the item is stored.
+ * \return	<b>true</b> if some item was taken, as in <code>pop()</code>.
+ * 			<b>false</b> when all the work is done.
+ * 
+ * While the other threads are processing items, and so may push more, the
+ * thread sleeps until it is woken by <code>push()</code> or
+ * <code>done()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool WorkPool::take(int thread, int &item)
+{
+	while (pop(thread, item) == false) {
+		
+		unique_lock<mutex> guard(IdleLock);
+		
+		// idle is counted before the check, so the threads that push or
+		// finish after it see it and wake this one
+		idle++;
+		
+		while (queued <= 0 && pending != 0) {
+			
+			Wakeup.wait(guard);
+		}
+		
+		idle--;
+		
+		if (pending == 0) {
+			
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+/**
+ * \brief	Marks an item taken with <code>pop()</code> as processed.
+ * 
+ * \fn		void WorkPool::done()
+ * 
+ * The items created while processing it must have been pushed before. The
+ * threads waiting in <code>take()</code> are woken when it is the last one.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void WorkPool::done()
+{
+	if (--pending == 0 && idle > 0) {
+		
+		wake(true);
+	}
+}
+
+/**
+ * \brief	Checks if all the work is done.
+ * 
+ * \fn		bool WorkPool::finished()
+ * \return	<b>true</b> if every item pushed was processed. <b>false</b>
+ * 			otherwise.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool WorkPool::finished()
+{
+	return pending == 0;
+}
+
+/**
+ * \brief	Gets the number of items waiting in the pool.
+ * 
+ * \fn		long WorkPool::size()
+ * \return	The number of items pushed and not yet done. It is only an
+ * 			estimate while the threads are running.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+long WorkPool::size()
+{
+	return pending;
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PRIVATE METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Wakes the threads waiting in <code>take()</code>.
+ * 
+ * \fn		void WorkPool::wake(bool all)
+ * \param	all: <b>true</b> to wake all of them, when the work is over.
+ * 			<b>false</b> to wake only one, for a new item.
+ * 
+ * The lock is taken so that a thread that has counted itself in
+ * <code>idle</code> is already waiting when it is signalled.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void WorkPool::wake(bool all)
+{
+	lock_guard<mutex> guard(IdleLock);
+	
+	if (all) {
+		
+		Wakeup.notify_all();
+	} else {
+		
+		Wakeup.notify_one();
+	}
+}
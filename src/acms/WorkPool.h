@@ -0,0 +1,97 @@
+/**
+ * \file		acms/WorkPool.h
+ * \brief		The definition of the <b>WorkPool</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+using namespace std;
+
+#include "config.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#ifndef WORKPOOL_H
+#define WORKPOOL_H
+
+/**
+ * \class	WorkPool WorkPool.h
+ * \brief	The <b>WorkPool</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>WorkPool</b> class. Keeps the states waiting to be expanded by a
+ * set of threads. Each thread has its own queue: it pushes and pops at the
+ * back of it and, when it is empty, steals from the front of the queues of
+ * the other threads.
+ * 
+ * The pool counts the states that have been pushed and not yet marked as
+ * <code>done()</code>. When it reaches zero there is no more work and no
+ * thread can create more, so the exploration is over.
+ * 
+ * A thread that finds no work in <code>take()</code> sleeps until a state is
+ * pushed or the exploration is over, instead of polling the queues.
+ */
+class WorkPool {
+	
+	public:
+		
+		WorkPool(int threads);
+		~WorkPool();
+		
+		void push(int thread, int item);
+		bool pop(int thread, int &item);
+		bool take(int thread, int &item);
+		void done();
+		bool finished();
+		long size();
+		
+	private:
+		
+		/** The queue of each thread. */
+		vector<deque<int> *> Queues;
+		
+		/** The lock of each queue. */
+		vector<mutex *> Locks;
+		
+		/** Number of items pushed and not yet done. */
+		atomic<long> pending;
+		
+		/** Number of items in the queues. */
+		atomic<long> queued;
+		
+		/** Number of threads sleeping in <code>take()</code>. */
+		atomic<int> idle;
+		
+		/** Taken to sleep in <code>take()</code> and to wake the threads. */
+		mutex IdleLock;
+		
+		/** Signalled when an item is pushed or the work is over. */
+		condition_variable Wakeup;
+		
+		void wake(bool all);
+};
+#endif /* WORKPOOL_H */
@@ -0,0 +1,136 @@
+/**
+ * \file		counting_new.cpp
+ * \brief		The counting <code>operator new</code>.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Replaces the global <code>operator new</code> and <code>operator
+ * delete</code> by ones that count each allocation in <b>Allocations</b>.
+ * It is linked only into <b>jabuti_bench</b>: the other programs keep the
+ * allocator of the library, and their counters stay at zero.
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "Allocations.h"
+
+#include <new>
+
+#include <stdlib.h>
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * GLOBAL OPERATORS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Allocates memory and counts the allocation.
+ *
+ * \fn		void * operator new(size_t size)
+ * \param	size: the number of bytes.
+ * \return	The allocated memory.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void * operator new(size_t size)
+{
+	void *p = malloc(size == 0 ? 1 : size);
+
+	if (p == NULL) {
+
+		throw bad_alloc();
+	}
+
+	Allocations::count(size);
+
+	return p;
+}
+
+/**
+ * \brief	Allocates memory for an array and counts the allocation.
+ *
+ * \fn		void * operator new[](size_t size)
+ * \param	size: the number of bytes.
+ * \return	The allocated memory.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void * operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+/**
+ * \brief	Frees memory allocated by <code>operator new</code>.
+ *
+ * \fn		void operator delete(void *p)
+ * \param	*p: the memory to free.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void operator delete(void *p) noexcept
+{
+	free(p);
+}
+
+/**
+ * \brief	Frees memory allocated by <code>operator new[]</code>.
+ *
+ * \fn		void operator delete[](void *p)
+ * \param	*p: the memory to free.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void operator delete[](void *p) noexcept
+{
+	free(p);
+}
+
+/**
+ * \brief	Frees memory allocated by <code>operator new</code>.
+ *
+ * \fn		void operator delete(void *p, size_t)
+ * \param	*p: the memory to free.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void operator delete(void *p, size_t) noexcept
+{
+	free(p);
+}
+
+/**
+ * \brief	Frees memory allocated by <code>operator new[]</code>.
+ *
+ * \fn		void operator delete[](void *p, size_t)
+ * \param	*p: the memory to free.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void operator delete[](void *p, size_t) noexcept
+{
+	free(p);
+}
@@ -35,7 +35,11 @@ using namespace std;
 #include "config.h"
 
 #include "StateGraph.h"
+#include "BatchRunner.h"
+#include "NetExplorer.h"
+#include "PNinvariants.h"
 #include "Penknife.h"
+#include "ResultCache.h"
 #include "Simulator.h"
 
 #include "SGParser.h"
@@ -44,6 +48,7 @@ using namespace std;
 #include <iostream>
 
 #include <getopt.h>
+#include <string.h>
 
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * FOR COMMAND LINE OPTIONS
@@ -55,6 +60,38 @@ using namespace std;
 /** The command line option for displaying version number of <b>jabuti</b>. */
 #define _VERSION						11
 
+/** The command line option for setting the number of threads. */
+#define _THREADS						12
+
+/** The command line option for streaming the output. */
+#define _STREAM							13
+
+/** The command line option for reporting the progress of the generation. */
+#define _STATS							14
+
+/** The command line option for exploring the states up to the rotation of
+ *  the cells. */
+#define _SYMMETRY						15
+
+/** The command line option for the partial order reduction. */
+#define _POR							16
+
+/** The command line option for generating the ACM in external memory. */
+#define _EXTERNAL						17
+
+/** The command line option for the memory of the external generation. */
+#define _MEMORY							18
+
+/** The command line option for writing the ACM in the binary format. */
+#define _BINARY							19
+
+/** The command line option for keeping the ACMs in a cache directory. */
+#define _CACHE							20
+
+/** The command line option for the number of jobs of a batch running at
+ *  the same time. */
+#define _WORKERS						21
+
 /** The command line option for synthesis of a <b>RRBB</b> AMC. */
 #define _RRBB							_CHANNEL_RRBB
 
@@ -73,6 +110,21 @@ using namespace std;
 /** The <b>simulation</b> command line option. */
 #define _SIM							202
 
+/** The command for synthesis of the ACM of a system read from a file. */
+#define _SYSTEM							203
+
+/** The command for writing an ACM saved in the binary format. */
+#define _LOAD							204
+
+/** The command for synthesis of the ACMs listed in a manifest. */
+#define _BATCH							205
+
+/** The reachability graph of the <b>Petri net</b> command line option. */
+#define _REACH							206
+
+/** The invariants of the <b>Petri net</b> command line option. */
+#define _INVARIANTS						207
+
 
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * CODE ERRORS
@@ -105,28 +157,66 @@ typedef struct parsed_options {
 	
 	/** The number of steps to be executed if simulation was required. */
 	int steps;
+	
+	/** The file with the description of the system (see
+	 *  <code>_SYSTEM</code>). */
+	char *file;
+	
+	/** The number of threads used to generate the ACM. */
+	int threads;
+	
+	/** If the state graph is written while it is generated. */
+	bool stream;
+	
+	/** If the progress of the generation is reported. */
+	bool stats;
+	
+	/** The file where the progress is reported. <code>NULL</code> for the
+	 *  standard error. */
+	char *statsfile;
+	
+	/** The symmetry reduction used to generate the ACM. */
+	int symmetry;
+	
+	/** If the partial order reduction is used to generate the ACM. */
+	bool por;
+	
+	/** If the ACM is generated in external memory. */
+	bool external;
+	
+	/** The directory of the scratch files. <code>NULL</code> for the
+	 *  default one. */
+	char *externaldir;
+	
+	/** The memory of the external generation, in bytes. */
+	long memory;
+	
+	/** The file where the ACM is written in the binary format.
+	 *  <code>NULL</code> to write it in the Petrify format. */
+	char *binary;
+	
+	/** The directory of the cache of ACMs. <code>NULL</code> for no cache.
+	 */
+	char *cache;
+	
+	/** The number of jobs of a batch running at the same time.
+	 *  <code>_NONE</code> for the default one (see
+	 *  <code>BatchRunner::defaultWorkers()</code>). */
+	int workers;
+	
+	/** The maximum number of rows used to compute the invariants. */
+	int rows;
 } p_options;
 
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * INITIALIZING CLASS VARIABLES
  * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
-int Process::nextTarget = 0;
-int Channel::nextTarget = 0;
-
-/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
- * GLOBAL VARIABLES
- * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
- 
-/** To be used inside <i>yyparser()</i>. It SHOULD exists. */
-SGParser sgparser;
-
-/** Used to set the input file name for LeX & Yacc. */
-extern FILE *yyin;
+atomic<int> Process::nextTarget(0);
+atomic<int> Channel::nextTarget(0);
 
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * FUNCTIONS PROTOTYPES
  * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
-int callParser(char *);
 p_options readCmdLine(int argc, char *argv[]);
 void jabuti_help(void);
 void jabuti_version(void);
@@ -170,10 +260,159 @@ int main(int argc, char *argv[])
 		exit(_SGPARSER_ERROR_NOT_EXISTS);
 	}
 	
-	StateGraph *acm = new StateGraph(op.command, op.size);
+	if (op.command == _LOAD) {
+		
+		ACMImage image(op.file);
+		
+		StateGraph::petrifyComments(argv, image.getStates(), image.getArcs());
+		image.petrify(cout);
+		exit(_SGPARSER_ERROR_NOT_EXISTS);
+	}
+	
+	if (op.command == _BATCH) {
+		
+		BatchRunner batch(op.file);
+		
+		batch.setThreads(op.threads);
+		batch.setWorkers(op.workers == _NONE ? \
+			BatchRunner::defaultWorkers(op.threads) : op.workers);
+		batch.setStream(op.stream);
+		batch.setSymmetry(op.symmetry);
+		batch.setReduction(op.por);
+		
+		if (op.external) {
+			
+			batch.setExternal(op.externaldir, op.memory);
+		}
+		
+		if (batch.run(cout) > 0) {
+			
+			exit(_BATCH_ERROR_CODE_JOBS);
+		}
+		
+		exit(_SGPARSER_ERROR_NOT_EXISTS);
+	}
+	
+	StateGraph *acm;
+	SGParser sgparser;
+	
+	if (op.command == _SYSTEM) {
+		
+		int r = sgparser.callSGParser(op.file);
+		
+		if (r == _SGPARSER_ERROR_CODE_FILE_OP) {
+			
+			Penknife::pkerrors(_SGPARSER_ERROR_FILE_OP, op.file);
+			exit(r);
+		} else if (r != _SGPARSER_ERROR_NOT_EXISTS) {
+			
+			Penknife::pkerrors(_SGPARSER_ERROR_MSG, op.file);
+			exit(r);
+		}
+		
+		acm = new StateGraph(sgparser.Channels, sgparser.Processes);
+	} else {
+		
+		acm = new StateGraph(op.command, op.size);
+	}
+	
+	if (op.args == _PETRI) {
+		
+		PNmodel *net = acm->acm2petrinet();
+		
+		StateGraph::petrinetComments(argv, net->getPlaces().size(), \
+			net->getTransitions().size());
+		net->petrify(cout);
+		
+		delete net;
+		exit(_SGPARSER_ERROR_NOT_EXISTS);
+	} else if (op.args == _REACH) {
+		
+		PNmodel *net = acm->acm2petrinet();
+		NetExplorer explorer(net);
+		
+		explorer.explore();
+		
+		StateGraph::petrifyComments(argv, explorer.getStates(), \
+			explorer.getArcs());
+		explorer.petrify(cout);
+		
+		delete net;
+		exit(_SGPARSER_ERROR_NOT_EXISTS);
+	} else if (op.args == _INVARIANTS) {
+		
+		PNmodel *net = acm->acm2petrinet();
+		PNmatrix matrix(net);
+		PNinvariants pinv(&matrix, _PN_P);
+		PNinvariants tinv(&matrix, _PN_T);
+		
+		pinv.setLimit(op.rows);
+		tinv.setLimit(op.rows);
+		pinv.compute();
+		tinv.compute();
+		
+		StateGraph::petrinetComments(argv, matrix.getPlaces(), \
+			matrix.getTransitions());
+		pinv.write(cout, net);
+		tinv.write(cout, net);
+		
+		delete net;
+		exit(_SGPARSER_ERROR_NOT_EXISTS);
+	}
+	
+	acm->setThreads(op.threads);
+	acm->setStream(op.stream);
+	acm->setSymmetry(op.symmetry);
+	acm->setReduction(op.por);
+	
+	if (op.external) {
+		
+		acm->setExternal(op.externaldir, op.memory);
+	}
+	
+	if (op.stats) {
+		
+		acm->setStats(op.statsfile);
+	}
+	
+	if (op.cache != NULL) {
+		
+		ResultCache cache(op.cache);
+		
+		cache.setKey(acm);
+		
+		ACMImage *image = cache.load();
+		
+		if (image == NULL) {
+			
+			cache.lock();
+			image = cache.load();
+			
+			if (image == NULL) {
+				
+				acm->makeACM();
+				acm->acm2binary(cache.create());
+				cache.store();
+				image = new ACMImage(cache.getFile().c_str());
+			}
+			
+			cache.unlock();
+		}
+		
+		StateGraph::petrifyComments(argv, image->getStates(), image->getArcs());
+		image->petrify(cout);
+		exit(_SGPARSER_ERROR_NOT_EXISTS);
+	}
 	
 	acm->makeACM();
-	acm->acm2petrify(argv);
+	
+	if (op.binary != NULL) {
+		
+		acm->acm2binary(op.binary);
+	} else {
+		
+		acm->acm2petrify(argv);
+	}
 	
 	/*
 	if (op.args == _ACM) {
@@ -223,6 +462,20 @@ p_options readCmdLine(int argc, char *argv[])
 	op.size = _NONE;
 	op.args = _NONE;
 	op.steps = _NONE;
+	op.file = NULL;
+	op.threads = _ACMS_THREADS;
+	op.stream = false;
+	op.stats = false;
+	op.statsfile = NULL;
+	op.symmetry = _ACMS_SYMMETRY_NONE;
+	op.por = false;
+	op.external = false;
+	op.externaldir = NULL;
+	op.memory = _ACMS_EXTERNAL_MEMORY;
+	op.binary = NULL;
+	op.cache = NULL;
+	op.workers = _NONE;
+	op.rows = _INVARIANTS_MAX_ROWS;
 	
 	int opt = 0;
 	//int digit_optind = 0;
@@ -234,8 +487,22 @@ p_options readCmdLine(int argc, char *argv[])
 		{"rrbb", 	required_argument, 	NULL, 	_RRBB},
 		{"owbb", 	required_argument, 	NULL, 	_OWBB},
 		{"owrrbb", 	required_argument, 	NULL, 	_OWRRBB},
+		{"threads", required_argument, 	NULL, 	_THREADS},
+		{"stream", 	no_argument, 		NULL, 	_STREAM},
+		{"stats", 	optional_argument, 	NULL, 	_STATS},
+		{"symmetry",optional_argument, 	NULL, 	_SYMMETRY},
+		{"por", 	no_argument, 		NULL, 	_POR},
+		{"external",optional_argument, 	NULL, 	_EXTERNAL},
+		{"memory", 	required_argument, 	NULL, 	_MEMORY},
+		{"binary", 	required_argument, 	NULL, 	_BINARY},
+		{"load", 	required_argument, 	NULL, 	_LOAD},
+		{"cache", 	required_argument, 	NULL, 	_CACHE},
+		{"batch", 	required_argument, 	NULL, 	_BATCH},
+		{"workers", required_argument, 	NULL, 	_WORKERS},
 		// {"acm", 	no_argument, 		NULL, 	_ACM},
-		// {"petri", 	no_argument, 		NULL, 	_PETRI},
+		{"petri", 	no_argument, 		NULL, 	_PETRI},
+		{"reach", 	no_argument, 		NULL, 	_REACH},
+		{"invariants", optional_argument, NULL, _INVARIANTS},
 		// {"sim", 	required_argument, 	NULL, 	_SIM},
 		{0, 		0, 					0, 		0}
 	};
@@ -268,6 +535,130 @@ p_options readCmdLine(int argc, char *argv[])
 				
 				break;
 				
+			case _THREADS:
+				
+				op.threads = atoi(optarg);
+				
+				if (op.threads < 1) {
+					
+					jabuti_help();
+					exit(_JABUTI_ERROR_CODE_SYNTAX);
+				}
+				
+				break;
+				
+			case _STREAM:
+				
+				op.stream = true;
+				break;
+				
+			case _STATS:
+				
+				op.stats = true;
+				op.statsfile = optarg;
+				break;
+				
+			case _SYMMETRY:
+				
+				if (optarg == NULL) {
+					
+					op.symmetry = _ACMS_SYMMETRY_QUOTIENT;
+				} else if (strcmp(optarg, "expand") == 0) {
+					
+					op.symmetry = _ACMS_SYMMETRY_EXPAND;
+				} else {
+					
+					jabuti_help();
+					exit(_JABUTI_ERROR_CODE_SYNTAX);
+				}
+				
+				break;
+				
+			case _POR:
+				
+				op.por = true;
+				break;
+				
+			case _EXTERNAL:
+				
+				op.external = true;
+				op.externaldir = optarg;
+				break;
+				
+			case _MEMORY:
+				
+				op.memory = atol(optarg) << 20;
+				
+				if (op.memory < 1) {
+					
+					jabuti_help();
+					exit(_JABUTI_ERROR_CODE_SYNTAX);
+				}
+				
+				break;
+				
+			case _BINARY:
+				
+				op.binary = optarg;
+				break;
+				
+			case _CACHE:
+				
+				op.cache = optarg;
+				break;
+				
+			case _LOAD:
+			case _BATCH:
+				
+				if (command) {
+					
+					jabuti_help();
+					exit(_JABUTI_ERROR_CODE_SYNTAX);
+				}
+				
+				command = true;
+				op.command = opt;
+				op.file = optarg;
+				break;
+				
+			case _WORKERS:
+				
+				op.workers = atoi(optarg);
+				
+				if (op.workers < 1) {
+					
+					jabuti_help();
+					exit(_JABUTI_ERROR_CODE_SYNTAX);
+				}
+				
+				break;
+				
+			case _PETRI:
+			case _REACH:
+			case _INVARIANTS:
+				
+				if (args) {
+					
+					jabuti_help();
+					exit(_JABUTI_ERROR_CODE_SYNTAX);
+				}
+				
+				args = true;
+				op.args = opt;
+				
+				if (opt == _INVARIANTS && optarg != NULL) {
+					
+					op.rows = atoi(optarg);
+					
+					if (op.rows < 1) {
+						
+						jabuti_help();
+						exit(_JABUTI_ERROR_CODE_SYNTAX);
+					}
+				}
+				
+				break;
+				
 			/*
 			case _ACM:
 			case _PETRI:
@@ -302,10 +693,64 @@ p_options readCmdLine(int argc, char *argv[])
 		}
 	}
 	
+	if (command == false && optind == argc - 1) {
+		
+		command = true;
+		op.command = _SYSTEM;
+		op.file = argv[optind];
+	} else if (optind != argc) {
+		
+		jabuti_help();
+		exit(_JABUTI_ERROR_CODE_SYNTAX);
+	}
+	
 	if (command == false) {
 		
 		jabuti_help();
 		exit(_JABUTI_ERROR_CODE_SYNTAX);
+	} else if (op.cache != NULL
+				&& (op.stream || op.external || op.binary != NULL)) {
+		
+		// the cached ACMs are written from the binary format
+		jabuti_help();
+		exit(_JABUTI_ERROR_CODE_SYNTAX);
+	} else if (op.por && (op.threads > 1 || op.external
+				|| op.symmetry != _ACMS_SYMMETRY_NONE)) {
+		
+		// the partial order reduction is only done by the sequential
+		// generation in memory without symmetry reduction
+		jabuti_help();
+		exit(_JABUTI_ERROR_CODE_SYNTAX);
+	} else if (op.symmetry != _ACMS_SYMMETRY_NONE && op.external) {
+		
+		// the generation in external memory does not reduce by symmetry
+		jabuti_help();
+		exit(_JABUTI_ERROR_CODE_SYNTAX);
+	} else if (op.workers != _NONE && op.command != _BATCH) {
+		
+		jabuti_help();
+		exit(_JABUTI_ERROR_CODE_SYNTAX);
+	} else if (op.command == _BATCH
+				&& (op.stats || op.binary != NULL || op.cache != NULL)) {
+		
+		// each job is written to its own file in the Petrify format
+		jabuti_help();
+		exit(_JABUTI_ERROR_CODE_SYNTAX);
+	} else if ((op.args == _PETRI || op.args == _REACH
+				|| op.args == _INVARIANTS)
+				&& (op.command == _LOAD || op.command == _BATCH || op.stream
+				|| op.stats || op.external || op.binary != NULL
+				|| op.cache != NULL || op.symmetry != _ACMS_SYMMETRY_NONE
+				|| op.por)) {
+		
+		// the net is built from the system, without generating the ACM
+		jabuti_help();
+		exit(_JABUTI_ERROR_CODE_SYNTAX);
+	} else if (op.command == _SYSTEM || op.command == _LOAD
+				|| op.command == _BATCH) {
+		
+		// the channels are checked by the parser, the file by ACMImage and
+		// the jobs by BatchRunner
 	} else if (op.command != _VERSION 
 				&& op.command != _HELP
 				&& op.size < 2) {
@@ -336,58 +781,6 @@ p_options readCmdLine(int argc, char *argv[])
 	return op;
 }
 
-/**
- * \brief	Calls <b>yacc</b> functions to parse input file.
- * 
- * \fn		int callParser(char *f)
- * \param	*f: the name of the file with the system description.
- * \return	An integer containing:
- * 			- <code>_SGPARSER_ERROR_NOT_EXISTS</code> if the input file contains
- * 			  no parser errors.
- * 			- <code>_SGPARSER_ERROR_EXISTS</code> if the file contains some
- * 			  paser error.
- * 			- <code>_SGPARSER_ERROR_CODE_FILE_OP</code> if it was not possible
- * 			  to open the input file.
- * 			- <code>_SGPARSER_ERROR_CODE_FILE_CL</code> if there was an error
- * 			  when closing the input file.
- * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	14/06/2004
- */
-int callParser(char *f)
-{
-	#ifdef _JABUTI_APPS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " callParser()" << endl;
-	#endif
-	
-	FILE *srcfile;
-	
-	if ((srcfile = fopen(f, "rb")) == NULL) {
-		
-		return _SGPARSER_ERROR_CODE_FILE_OP;
-	}
-	
-	yyin = srcfile;
-	
-	yyparse();
-	
-	if (fclose(srcfile) != 0) {
-		
-		return _SGPARSER_ERROR_CODE_FILE_CL;
-	}
-	
-	if (sgparser.hasErrors() == true) {
-		
-		return _SGPARSER_ERROR_EXISTS;
-	}
-	
-	#ifdef _JABUTI_APPS_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /callParser()" << endl;
-	#endif
-	
-	return _SGPARSER_ERROR_NOT_EXISTS;
-}
-
 /**
  * \brief	Prints the syntax of <b>jabuti</b>.
  * 
@@ -398,15 +791,89 @@ int callParser(char *f)
  */
 void jabuti_help(void)
 {
-	cout << "usage: jabuti command argumments" << endl << endl;
+	cout << "usage: jabuti command argumments" << endl;
+	cout << "       jabuti argumments file.sg" << endl << endl;
 	
 	cout << "command" << endl;
 	cout << "    --help        shows this message" << endl;
 	cout << "    --version     shows version number" << endl;
 	cout << "    --rrbb n      generates a RRBB ACM with n cells" << endl;
 	cout << "    --owbb n      generates a OWBB ACM with n cells" << endl;
-	cout << "    --owrrbb n    generates a OWRRBB ACM with n cells" << endl
+	cout << "    --owrrbb n    generates a OWRRBB ACM with n cells" << endl;
+	cout << "    file.sg       generates the ACM of the system described in"
+		 << endl;
+	cout << "                  file.sg" << endl;
+	cout << "    --load f      writes the ACM saved in the binary file f"
+		 << endl;
+	cout << "    --batch f     generates the ACMs listed in the manifest f, one"
+		 << endl;
+	cout << "                  per line as \"policy cells output\", each one in"
+		 << endl;
+	cout << "                  its own file, and writes a summary of the jobs"
+		 << endl;
+	cout << "                  (not with --stats, --binary or --cache)" << endl
+		 << endl;
+	
+	cout << "options" << endl;
+	cout << "    --threads n   uses n threads to generate the ACM" << endl;
+	cout << "    --stream      writes the state graph while it is generated"
+		 << endl;
+	cout << "    --stats[=f]   reports the progress of the generation to the"
+		 << endl;
+	cout << "                  standard error (or to the file f)" << endl;
+	cout << "    --symmetry    explores the states up to the rotation of the"
+		 << endl;
+	cout << "                  cells and writes the quotient graph" << endl;
+	cout << "    --symmetry=expand" << endl;
+	cout << "                  idem, but expands the quotient to the full graph"
+		 << endl;
+	cout << "                  (not with --external)" << endl;
+	cout << "    --por         expands only the local moves of one process when"
+		 << endl;
+	cout << "                  they commute with the rest (partial order"
+		 << endl;
+	cout << "                  reduction; not with more than one thread,"
+		 << endl;
+	cout << "                  --symmetry or --external)" << endl;
+	cout << "    --external[=d]" << endl;
+	cout << "                  generates the ACM in external memory, with"
+		 << endl;
+	cout << "                  scratch files in the directory d" << endl;
+	cout << "    --memory n    uses about n MB of memory with --external"
+		 << endl;
+	cout << "    --binary f    writes the ACM to the file f in a binary format"
+		 << endl;
+	cout << "                  (see --load)" << endl;
+	cout << "    --cache d     keeps the ACMs in the directory d and writes the"
+		 << endl;
+	cout << "                  ones already there without generating them"
+		 << endl;
+	cout << "                  (not with --stream, --external or --binary)"
+		 << endl;
+	cout << "    --workers n   runs at most n jobs of --batch at the same time"
+		 << endl;
+	cout << "                  (default: the processors divided by --threads)"
+		 << endl;
+	cout << "    --petri       writes a Petri net whose reachability graph is"
+		 << endl;
+	cout << "                  the ACM, without generating it" << endl;
+	cout << "    --reach       writes the reachability graph of the net of"
+		 << endl;
+	cout << "                  --petri, in the format of the ACMs" << endl;
+	cout << "    --invariants[=n]" << endl;
+	cout << "                  writes the minimal P- and T-invariants of the"
+		 << endl;
+	cout << "                  net of --petri, giving up on the ones that need"
+		 << endl;
+	cout << "                  more than n rows (default: "
+		 << _INVARIANTS_MAX_ROWS << ")" << endl;
+	cout << "                  (--petri, --reach and --invariants can not be"
+		 << endl;
+	cout << "                  given with --load, --batch, --stream, --stats,"
+		 << endl;
+	cout << "                  --symmetry, --por, --external, --binary or"
 		 << endl;
+	cout << "                  --cache; they ignore --threads)" << endl << endl;
 	
 	/* cout << "argumments" << endl;
 	cout << "    --acm         generates the state graph for the AMC" << endl;
@@ -0,0 +1,718 @@
+/**
+ * \file		jabuti_bench.cpp
+ * \brief		The <b>jabuti_bench</b> application.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ *
+ * Benchmark of the synthesis of ACMs. This file contain the routines of the
+ * <b>jabuti_bench</b> application, that generates the ACMs of the given
+ * policies for a range of sizes and measures how long
+ * <code>StateGraph::makeACM()</code> and <code>StateGraph::acm2petrify()</code>
+ * take, and how much memory they use. The results are printed in CSV or JSON
+ * format, one record for each policy and size.
+ *
+ * With <code>--parse</code> it measures the parser of <code>.sg</code>
+ * files instead, on generated systems of growing size.
+ *
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * $Id$
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include "Allocations.h"
+#include "SGParser.h"
+#include "StateGraph.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * FOR COMMAND LINE OPTIONS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** The command line option for displaying help massage. */
+#define _HELP							10
+
+/** The command line option for setting the number of threads. */
+#define _THREADS						12
+
+/** The command line option for streaming the output. */
+#define _STREAM							13
+
+/** The command line option for choosing the policies. */
+#define _POLICY							20
+
+/** The command line option for the smallest number of cells. */
+#define _FROM							21
+
+/** The command line option for the largest number of cells. */
+#define _TO								22
+
+/** The command line option for the format of the results. */
+#define _FORMAT							23
+
+/** The command line option for measuring the parser. */
+#define _PARSE							24
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFAULTS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** The smallest number of cells by default. */
+#define _BENCH_FROM						2
+
+/** The largest number of cells by default. */
+#define _BENCH_TO						6
+
+/** The results are printed as comma separated values. */
+#define _BENCH_CSV						0
+
+/** The results are printed as a JSON array. */
+#define _BENCH_JSON						1
+
+/** Where the generated <b>petrify</b> files are written. */
+#define _BENCH_SINK						"/dev/null"
+
+/** The number of sizes of the systems parsed with <code>--parse</code>. */
+#define _BENCH_PARSE_SIZES				4
+
+/** The template of the name of the systems parsed with
+ *  <code>--parse</code>. */
+#define _BENCH_PARSE_FILE				"/tmp/jabuti_bench.XXXXXX"
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CODE ERRORS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Error code: wrong syntax when calling the program. */
+#define _BENCH_ERROR_CODE_SYNTAX		10
+
+/** Error code: a measurement could not be done. */
+#define _BENCH_ERROR_CODE_RUN			11
+
+/** Error code: memory was allocated while generating the successors. */
+#define _BENCH_ERROR_CODE_ALLOCATIONS	12
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * Data structures
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** <code>struct</code> to store command line options. */
+typedef struct bench_options {
+
+	/** The policies to measure. */
+	vector<int> policies;
+
+	/** The smallest number of cells. */
+	int from;
+
+	/** The largest number of cells. */
+	int to;
+
+	/** The number of threads used to generate the ACM. */
+	int threads;
+
+	/** If the state graph is written while it is generated. */
+	bool stream;
+
+	/** The format of the results (<code>_BENCH_CSV</code> or
+	 *  <code>_BENCH_JSON</code>). */
+	int format;
+
+	/** The number of states of each process of the largest system parsed.
+	 *  Zero to measure the synthesis instead. */
+	int parse;
+} b_options;
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * INITIALIZING CLASS VARIABLES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+atomic<int> Process::nextTarget(0);
+atomic<int> Channel::nextTarget(0);
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * FUNCTIONS PROTOTYPES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+b_options readCmdLine(int argc, char *argv[]);
+void measure(b_options &op, int policy, int cells, bool first, char *argv[]);
+void benchParser(b_options &op);
+void measureParser(b_options &op, int states, bool first);
+void writeSystem(FILE *f, int states);
+const char * policyName(int policy);
+double seconds(chrono::steady_clock::time_point start);
+void bench_help(void);
+
+/**
+ * \brief	This is the main program of <b>jabuti_bench</b>.
+ *
+ * \fn		int main(int argc, char *argv[])
+ * \param	argc: number of arguments.
+ * \param	*argv: list of arguments.
+ * \return	Zero if all measurements were done.
+ *
+ * Each measurement runs in its own process, so the peak resident set size
+ * of one does not hide the ones of the next.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int main(int argc, char *argv[])
+{
+	b_options op = readCmdLine(argc, argv);
+	bool first = true;
+
+	if (op.parse > 0) {
+
+		benchParser(op);
+		exit(0);
+	}
+
+	if (op.format == _BENCH_CSV) {
+
+		cout << "policy,cells,threads,stream,states,arcs,make_s,petrify_s,"
+			 << "states_per_s,arcs_per_s,peak_rss_kb,bytes_per_state,allocations,"
+			 << "successor_allocations" << endl;
+	} else {
+
+		cout << "[" << endl;
+	}
+
+	for (int p = 0; p < op.policies.size(); p++) {
+
+		for (int cells = op.from; cells <= op.to; cells++) {
+
+			int status;
+			pid_t pid = fork();
+
+			if (pid == 0) {
+
+				measure(op, op.policies[p], cells, first, argv);
+				exit(0);
+			}
+
+			if (pid < 0 || waitpid(pid, &status, 0) != pid
+				|| WIFEXITED(status) == false || WEXITSTATUS(status) != 0) {
+
+				cerr << "jabuti_bench: " << policyName(op.policies[p])
+					 << " " << cells << " failed" << endl;
+				exit(_BENCH_ERROR_CODE_RUN);
+			}
+
+			first = false;
+		}
+	}
+
+	if (op.format == _BENCH_JSON) {
+
+		cout << endl << "]" << endl;
+	}
+
+	exit(0);
+}
+
+/**
+ * \brief	Measures the synthesis of one ACM and prints the results.
+ *
+ * \fn		void measure(b_options &op, int policy, int cells, bool first,
+															char *argv[])
+ * \param	op: the command line options.
+ * \param	policy: the policy of the channel.
+ * \param	cells: the number of cells of the channel.
+ * \param	first: <b>true</b> if this is the first record printed.
+ * \param	*argv[]: the command line, passed to
+ * 			<code>StateGraph::acm2petrify()</code>.
+ *
+ * The <b>petrify</b> file is written to <code>_BENCH_SINK</code>, so the
+ * time of <code>acm2petrify()</code> includes formatting and writing but
+ * not any terminal.
+ *
+ * The allocations are counted for the whole <code>makeACM()</code>, which
+ * grows the store and the <code>ACM</code>, and for the generation of the
+ * successors alone (see <code>StateGraph::getSuccessorAllocations()</code>).
+ * The last ones must be zero: otherwise the process ends with
+ * <code>_BENCH_ERROR_CODE_ALLOCATIONS</code> after printing the record.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void measure(b_options &op, int policy, int cells, bool first, char *argv[])
+{
+	StateGraph *acm = new StateGraph(policy, cells);
+	ofstream sink(_BENCH_SINK);
+	streambuf *out;
+	struct rusage usage;
+	double make, petrify;
+	long bytes, allocations, successors;
+	int states, arcs;
+
+	acm->setThreads(op.threads);
+	acm->setStream(op.stream);
+
+	bytes = Allocations::getBytes();
+	allocations = Allocations::getTotal();
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	acm->makeACM();
+
+	make = seconds(start);
+	bytes = Allocations::getBytes() - bytes;
+	allocations = Allocations::getTotal() - allocations;
+	successors = acm->getSuccessorAllocations();
+
+	out = cout.rdbuf(sink.rdbuf());
+	start = chrono::steady_clock::now();
+
+	acm->acm2petrify(argv);
+	cout.flush();
+
+	petrify = seconds(start);
+	cout.rdbuf(out);
+
+	getrusage(RUSAGE_SELF, &usage);
+	states = acm->getStates();
+	arcs = acm->getArcs();
+
+	double sps = make > 0 ? states / make : 0;
+	double aps = make > 0 ? arcs / make : 0;
+	double bps = states > 0 ? (double) bytes / states : 0;
+
+	if (op.format == _BENCH_CSV) {
+
+		cout << policyName(policy) << "," << cells << "," << op.threads << ","
+			 << (op.stream ? 1 : 0) << "," << states << "," << arcs << ","
+			 << make << "," << petrify << "," << sps << "," << aps << ","
+			 << usage.ru_maxrss << "," << bps << "," << allocations << ","
+			 << successors << endl;
+	} else {
+
+		cout << (first ? "" : ",\n") << "  {\"policy\": \""
+			 << policyName(policy) << "\", \"cells\": " << cells
+			 << ", \"threads\": " << op.threads
+			 << ", \"stream\": " << (op.stream ? "true" : "false")
+			 << ", \"states\": " << states << ", \"arcs\": " << arcs
+			 << ", \"make_s\": " << make << ", \"petrify_s\": " << petrify
+			 << ", \"states_per_s\": " << sps << ", \"arcs_per_s\": " << aps
+			 << ", \"peak_rss_kb\": " << usage.ru_maxrss
+			 << ", \"bytes_per_state\": " << bps
+			 << ", \"allocations\": " << allocations
+			 << ", \"successor_allocations\": " << successors << "}" << flush;
+	}
+
+	if (successors > 0) {
+
+		cerr << "jabuti_bench: " << policyName(policy) << " " << cells
+			 << " allocated " << successors
+			 << " times while generating successors" << endl;
+		exit(_BENCH_ERROR_CODE_ALLOCATIONS);
+	}
+}
+
+/**
+ * \brief	Measures the parser on systems of growing size.
+ *
+ * \fn		void benchParser(b_options &op)
+ * \param	op: the command line options.
+ *
+ * The processes of the largest system have <code>op.parse</code> states;
+ * the size is halved <code>_BENCH_PARSE_SIZES</code> - 1 times for the
+ * smaller ones. The time per state should not grow with the size.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void benchParser(b_options &op)
+{
+	bool first = true;
+
+	if (op.format == _BENCH_CSV) {
+
+		cout << "states,arcs,bytes,parse_s,states_per_s,mb_per_s,peak_rss_kb"
+			 << endl;
+	} else {
+
+		cout << "[" << endl;
+	}
+
+	for (int cont = _BENCH_PARSE_SIZES - 1; cont >= 0; cont--) {
+
+		int status, states = op.parse >> cont;
+		pid_t pid;
+
+		if (states < 2) {
+
+			continue;
+		}
+
+		pid = fork();
+
+		if (pid == 0) {
+
+			measureParser(op, states, first);
+			exit(0);
+		}
+
+		if (pid < 0 || waitpid(pid, &status, 0) != pid
+			|| WIFEXITED(status) == false || WEXITSTATUS(status) != 0) {
+
+			cerr << "jabuti_bench: parse " << states << " failed" << endl;
+			exit(_BENCH_ERROR_CODE_RUN);
+		}
+
+		first = false;
+	}
+
+	if (op.format == _BENCH_JSON) {
+
+		cout << endl << "]" << endl;
+	}
+}
+
+/**
+ * \brief	Measures the parsing of one generated system and prints the
+ * 			results.
+ *
+ * \fn		void measureParser(b_options &op, int states, bool first)
+ * \param	op: the command line options.
+ * \param	states: the number of states of each process.
+ * \param	first: <b>true</b> if this is the first record printed.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void measureParser(b_options &op, int states, bool first)
+{
+	char file[] = _BENCH_PARSE_FILE;
+	int fd = mkstemp(file);
+	FILE *f = fd == -1 ? NULL : fdopen(fd, "w");
+	SGParser sgparser;
+	struct rusage usage;
+	double parse;
+	long bytes;
+	int total = 0, arcs = 0;
+
+	if (f == NULL) {
+
+		exit(_BENCH_ERROR_CODE_RUN);
+	}
+
+	writeSystem(f, states);
+	bytes = ftell(f);
+	fclose(f);
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	int r = sgparser.callSGParser(file);
+
+	parse = seconds(start);
+	unlink(file);
+
+	if (r != _SGPARSER_ERROR_NOT_EXISTS) {
+
+		exit(_BENCH_ERROR_CODE_RUN);
+	}
+
+	getrusage(RUSAGE_SELF, &usage);
+
+	for (int cont = 0; cont < sgparser.Processes.size(); cont++) {
+
+		total += sgparser.Processes[cont]->States.size();
+		arcs += sgparser.Processes[cont]->Arcs.size();
+	}
+
+	double sps = parse > 0 ? total / parse : 0;
+	double mbps = parse > 0 ? bytes / parse / (1 << 20) : 0;
+
+	if (op.format == _BENCH_CSV) {
+
+		cout << total << "," << arcs << "," << bytes << "," << parse << ","
+			 << sps << "," << mbps << "," << usage.ru_maxrss << endl;
+	} else {
+
+		cout << (first ? "" : ",\n") << "  {\"states\": " << total
+			 << ", \"arcs\": " << arcs << ", \"bytes\": " << bytes
+			 << ", \"parse_s\": " << parse << ", \"states_per_s\": " << sps
+			 << ", \"mb_per_s\": " << mbps
+			 << ", \"peak_rss_kb\": " << usage.ru_maxrss << "}" << flush;
+	}
+}
+
+/**
+ * \brief	Writes a system to be parsed.
+ *
+ * \fn		void writeSystem(FILE *f, int states)
+ * \param	*f: the file.
+ * \param	states: the number of states of each process.
+ *
+ * The system has a writer and a reader around a channel. Each one is a
+ * cycle of <i>states</i> states with a different label on each local arc,
+ * so all the identifiers must be looked up in the tables of the parser.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void writeSystem(FILE *f, int states)
+{
+	const char *proc[] = {"writer", "reader"};
+	const char *io[] = {"write(CH)", "read(CH)"};
+	char state[] = {'w', 'r'};
+	char arc[] = {'x', 'y'};
+
+	fprintf(f, "channel CH 2 pool;\n");
+
+	for (int p = 0; p < 2; p++) {
+
+		fprintf(f, "\nprocess %s\n", proc[p]);
+
+		for (int cont = 0; cont < states - 1; cont++) {
+
+			fprintf(f, "\t%c%d %c%d %c%d;\n", state[p], cont, arc[p], cont,
+					state[p], cont + 1);
+		}
+
+		fprintf(f, "\t%c%d %s %c0;\nend\n", state[p], states - 1, io[p],
+				state[p]);
+	}
+}
+
+/**
+ * \brief	Parse the command line passed to <b>jabuti_bench</b>.
+ *
+ * \fn		b_options readCmdLine(int argc, char *argv[])
+ * \param	argc: number of arguments.
+ * \param	*argv: list of arguments.
+ * \return	The values passed by command line.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+b_options readCmdLine(int argc, char *argv[])
+{
+	b_options op;
+
+	op.from = _BENCH_FROM;
+	op.to = _BENCH_TO;
+	op.threads = _ACMS_THREADS;
+	op.stream = false;
+	op.format = _BENCH_CSV;
+	op.parse = 0;
+
+	int opt = 0;
+	int options_index = 0;
+	static struct option options[] = {
+		{"help", 	no_argument, 		NULL, 	_HELP},
+		{"policy", 	required_argument, 	NULL, 	_POLICY},
+		{"from", 	required_argument, 	NULL, 	_FROM},
+		{"to", 		required_argument, 	NULL, 	_TO},
+		{"format", 	required_argument, 	NULL, 	_FORMAT},
+		{"threads", required_argument, 	NULL, 	_THREADS},
+		{"stream", 	no_argument, 		NULL, 	_STREAM},
+		{"parse", 	required_argument, 	NULL, 	_PARSE},
+		{0, 		0, 					0, 		0}
+	};
+
+	while ((opt = getopt_long_only(argc, argv, "", options, &options_index))
+																	!= -1) {
+
+		switch (opt) {
+
+			case _HELP:
+
+				bench_help();
+				exit(0);
+
+			case _POLICY:
+
+				if (strcmp(optarg, "rrbb") == 0) {
+
+					op.policies.push_back(_CHANNEL_RRBB);
+				} else if (strcmp(optarg, "owbb") == 0) {
+
+					op.policies.push_back(_CHANNEL_OWBB);
+				} else if (strcmp(optarg, "owrrbb") == 0) {
+
+					op.policies.push_back(_CHANNEL_OWRRBB);
+				} else {
+
+					bench_help();
+					exit(_BENCH_ERROR_CODE_SYNTAX);
+				}
+
+				break;
+
+			case _FROM:
+
+				op.from = atoi(optarg);
+				break;
+
+			case _TO:
+
+				op.to = atoi(optarg);
+				break;
+
+			case _FORMAT:
+
+				if (strcmp(optarg, "csv") == 0) {
+
+					op.format = _BENCH_CSV;
+				} else if (strcmp(optarg, "json") == 0) {
+
+					op.format = _BENCH_JSON;
+				} else {
+
+					bench_help();
+					exit(_BENCH_ERROR_CODE_SYNTAX);
+				}
+
+				break;
+
+			case _THREADS:
+
+				op.threads = atoi(optarg);
+				break;
+
+			case _STREAM:
+
+				op.stream = true;
+				break;
+
+			case _PARSE:
+
+				op.parse = atoi(optarg);
+
+				if (op.parse < 2) {
+
+					bench_help();
+					exit(_BENCH_ERROR_CODE_SYNTAX);
+				}
+
+				break;
+
+			default:
+
+				bench_help();
+				exit(_BENCH_ERROR_CODE_SYNTAX);
+		}
+	}
+
+	if (op.from < 2 || op.to < op.from || op.threads < 1 || optind < argc) {
+
+		bench_help();
+		exit(_BENCH_ERROR_CODE_SYNTAX);
+	}
+
+	if (op.policies.size() == 0) {
+
+		op.policies.push_back(_CHANNEL_RRBB);
+		op.policies.push_back(_CHANNEL_OWBB);
+		op.policies.push_back(_CHANNEL_OWRRBB);
+	}
+
+	return op;
+}
+
+/**
+ * \brief	Gets the name of a policy.
+ *
+ * \fn		const char * policyName(int policy)
+ * \param	policy: the policy of the channel.
+ * \return	The name used in the command line of <b>jabuti</b>.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const char * policyName(int policy)
+{
+	switch (policy) {
+
+		case _CHANNEL_RRBB:
+
+			return "rrbb";
+
+		case _CHANNEL_OWBB:
+
+			return "owbb";
+
+		default:
+
+			return "owrrbb";
+	}
+}
+
+/**
+ * \brief	Gets the time elapsed since a given moment.
+ *
+ * \fn		double seconds(chrono::steady_clock::time_point start)
+ * \param	start: the moment.
+ * \return	The number of seconds elapsed.
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+double seconds(chrono::steady_clock::time_point start)
+{
+	chrono::duration<double> d = chrono::steady_clock::now() - start;
+
+	return d.count();
+}
+
+/**
+ * \brief	Prints the syntax of <b>jabuti_bench</b>.
+ *
+ * \fn		void bench_help(void)
+ *
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void bench_help(void)
+{
+	cout << "usage: jabuti_bench [options]" << endl << endl;
+
+	cout << "options" << endl;
+	cout << "    --help        shows this message" << endl;
+	cout << "    --policy p    measures the policy p (rrbb, owbb or owrrbb)."
+		 << endl;
+	cout << "                  May be repeated. All of them by default" << endl;
+	cout << "    --from n      smallest number of cells (default "
+		 << _BENCH_FROM << ")" << endl;
+	cout << "    --to n        largest number of cells (default "
+		 << _BENCH_TO << ")" << endl;
+	cout << "    --format f    prints the results as csv (default) or json"
+		 << endl;
+	cout << "    --threads n   uses n threads to generate the ACM" << endl;
+	cout << "    --stream      writes the state graph while it is generated"
+		 << endl;
+	cout << "    --parse n     measures the parser instead, on systems whose"
+		 << endl;
+	cout << "                  processes have up to n states" << endl << endl;
+}
@@ -0,0 +1,611 @@
+/**
+ * \file		petri/PNinvariants.cpp
+ * \brief		The methods of the <b>PNinvariants</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ * 
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "PNinvariants.h"
+
+#include <algorithm>
+
+#include <assert.h>
+
+/** The bits of a word of the supports. */
+#define _INVARIANTS_WORD_BITS				(8 * sizeof(unsigned long))
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new <b>PNinvariants</b> element.
+ * 
+ * \fn		PNinvariants::PNinvariants(PNmatrix *matrix, int type)
+ * \param	*matrix: the incidence matrix of the net.
+ * \param	type: <code>_PN_P</code> for the P-invariants and
+ * 			<code>_PN_T</code> for the T-invariants.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+PNinvariants::PNinvariants(PNmatrix *matrix, int type)
+{
+	Matrix = matrix;
+	this->type = type;
+	limit = _INVARIANTS_MAX_ROWS;
+	complete = false;
+}
+
+/**
+ * \brief	Class destructor.
+ * 
+ * \fn		PNinvariants::~PNinvariants()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+PNinvariants::~PNinvariants()
+{}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Sets the maximum number of rows of the elimination.
+ * 
+ * \fn		void PNinvariants::setLimit(int rows)
+ * \param	rows: the maximum number of rows.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PNinvariants::setLimit(int rows)
+{
+	limit = rows;
+}
+
+/**
+ * \brief	Computes the invariants.
+ * 
+ * \fn		bool PNinvariants::compute()
+ * \return	<b>true</b> if all the invariants were found. <b>false</b> if
+ * 			the elimination needed more rows than the limit. In this case
+ * 			there are no invariants.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool PNinvariants::compute()
+{
+	int column;
+	
+	setRows();
+	complete = false;
+	
+	while ((column = nextColumn()) >= 0) {
+		
+		if (eliminate(column) == false) {
+			
+			Rows.clear();
+			
+			return false;
+		}
+	}
+	
+	complete = true;
+	
+	return true;
+}
+
+/**
+ * \brief	Gets the number of invariants.
+ * 
+ * \fn		int PNinvariants::size()
+ * \return	The number of invariants found by <code>compute()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNinvariants::size()
+{
+	return Rows.size();
+}
+
+/**
+ * \brief	Gets the nodes of an invariant.
+ * 
+ * \fn		const vector<int> & PNinvariants::getNodes(int i)
+ * \param	i: the invariant.
+ * \return	The places (or transitions) with a weight in the invariant,
+ * 			sorted.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const vector<int> & PNinvariants::getNodes(int i)
+{
+	assert(i >= 0 && i < Rows.size());
+	
+	return Rows[i].nodes;
+}
+
+/**
+ * \brief	Gets the weights of an invariant.
+ * 
+ * \fn		const vector<long> & PNinvariants::getWeights(int i)
+ * \param	i: the invariant.
+ * \return	The weights of the nodes of <code>getNodes()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const vector<long> & PNinvariants::getWeights(int i)
+{
+	assert(i >= 0 && i < Rows.size());
+	
+	return Rows[i].weights;
+}
+
+/**
+ * \brief	Checks if every node is in some invariant.
+ * 
+ * \fn		bool PNinvariants::isCovered()
+ * \return	<b>true</b> if each place (or transition) has a weight in some
+ * 			invariant, so the net is conservative (or consistent).
+ * 			<b>false</b> otherwise.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool PNinvariants::isCovered()
+{
+	int n = type == _PN_P ? Matrix->getPlaces() : Matrix->getTransitions();
+	vector<bool> covered(n, false);
+	int cont, c2;
+	
+	for (cont = 0; cont < Rows.size(); cont++) {
+		
+		for (c2 = 0; c2 < Rows[cont].nodes.size(); c2++) {
+			
+			covered[Rows[cont].nodes[c2]] = true;
+		}
+	}
+	
+	return find(covered.begin(), covered.end(), false) == covered.end();
+}
+
+/**
+ * \brief	Writes the invariants.
+ * 
+ * \fn		void PNinvariants::write(ostream &out, PNmodel *net)
+ * \param	out: where the invariants are written.
+ * \param	*net: the net of the incidence matrix, for the labels.
+ * 
+ * Each invariant is a line with the sum of its nodes, times their weights.
+ * The P-invariants end with the tokens of the sum, that are the same in
+ * every reachable marking.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PNinvariants::write(ostream &out, PNmodel *net)
+{
+	int cont, c2;
+	
+	if (complete == false) {
+		
+		out << "# the" << (type == _PN_P ? " P" : " T") \
+			<< "-invariants need more than " << limit << " rows" << endl;
+		
+		return;
+	}
+	
+	out << "# " << Rows.size() << (type == _PN_P ? " P" : " T") \
+		<< "-invariants" << (isCovered() ? ", covering the net" : "") \
+		<< endl;
+	
+	for (cont = 0; cont < Rows.size(); cont++) {
+		
+		InvariantRow &r = Rows[cont];
+		long tokens = 0;
+		
+		for (c2 = 0; c2 < r.nodes.size(); c2++) {
+			
+			if (c2 > 0) {
+				
+				out << " + ";
+			}
+			
+			if (r.weights[c2] > 1) {
+				
+				out << r.weights[c2] << "*";
+			}
+			
+			if (type == _PN_P) {
+				
+				out << net->getPlaceLabel(r.nodes[c2]);
+				tokens += r.weights[c2] * Matrix->getMarking()[r.nodes[c2]];
+			} else {
+				
+				out << net->getTransitionLabel(r.nodes[c2]);
+			}
+		}
+		
+		if (type == _PN_P) {
+			
+			out << " = " << tokens;
+		}
+		
+		out << endl;
+	}
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PRIVATE METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Sets the rows to the identity and the incidence matrix.
+ * 
+ * \fn		void PNinvariants::setRows()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PNinvariants::setRows()
+{
+	int n = type == _PN_P ? Matrix->getPlaces() : Matrix->getTransitions();
+	int words = (n + _INVARIANTS_WORD_BITS - 1) / _INVARIANTS_WORD_BITS;
+	int e;
+	
+	Rows.assign(n, InvariantRow());
+	
+	for (int i = 0; i < n; i++) {
+		
+		InvariantRow &r = Rows[i];
+		
+		r.nodes.push_back(i);
+		r.weights.push_back(1);
+		
+		if (type == _PN_P) {
+			
+			for (e = Matrix->getFirstIncidence(i); \
+									e < Matrix->getLastIncidence(i); e++) {
+				
+				r.columns.push_back(Matrix->getIncidenceTransition(e));
+				r.values.push_back(Matrix->getIncidenceValue(e));
+			}
+		} else {
+			
+			for (e = Matrix->getFirstEffect(i); \
+									e < Matrix->getLastEffect(i); e++) {
+				
+				r.columns.push_back(Matrix->getEffectPlace(e));
+				r.values.push_back(Matrix->getEffectValue(e));
+			}
+		}
+		
+		r.support.assign(words, 0);
+		r.support[i / _INVARIANTS_WORD_BITS] |= \
+			1UL << (i % _INVARIANTS_WORD_BITS);
+	}
+}
+
+/**
+ * \brief	Chooses the next column to eliminate.
+ * 
+ * \fn		int PNinvariants::nextColumn()
+ * \return	The column whose elimination adds the fewest rows (the positive
+ * 			times the negative entries, minus the rows removed). -1 if all
+ * 			the columns are zero.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNinvariants::nextColumn()
+{
+	int n = type == _PN_P ? Matrix->getTransitions() : Matrix->getPlaces();
+	vector<long> pos(n, 0), neg(n, 0);
+	int cont, c2, best = -1;
+	long cost = 0;
+	
+	for (cont = 0; cont < Rows.size(); cont++) {
+		
+		for (c2 = 0; c2 < Rows[cont].columns.size(); c2++) {
+			
+			if (Rows[cont].values[c2] > 0) {
+				
+				pos[Rows[cont].columns[c2]]++;
+			} else {
+				
+				neg[Rows[cont].columns[c2]]++;
+			}
+		}
+	}
+	
+	for (cont = 0; cont < n; cont++) {
+		
+		long c = pos[cont] * neg[cont] - pos[cont] - neg[cont];
+		
+		if (pos[cont] + neg[cont] > 0 && (best < 0 || c < cost)) {
+			
+			best = cont;
+			cost = c;
+		}
+	}
+	
+	return best;
+}
+
+/**
+ * \brief	Eliminates a column.
+ * 
+ * \fn		bool PNinvariants::eliminate(int column)
+ * \param	column: the column.
+ * \return	<b>false</b> if there would be more rows than the limit.
+ * 			<b>true</b> otherwise.
+ * 
+ * The rows where the column is zero are kept, and the ones where it is not
+ * are replaced by their minimal combinations.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool PNinvariants::eliminate(int column)
+{
+	vector<int> pos, neg, all;
+	vector<InvariantRow> next;
+	int cont, c2;
+	
+	for (cont = 0; cont < Rows.size(); cont++) {
+		
+		long v = get(Rows[cont], column);
+		
+		if (v > 0) {
+			
+			pos.push_back(cont);
+		} else if (v < 0) {
+			
+			neg.push_back(cont);
+		} else {
+			
+			next.push_back(Rows[cont]);
+		}
+		
+		all.push_back(cont);
+	}
+	
+	for (cont = 0; cont < pos.size(); cont++) {
+		
+		for (c2 = 0; c2 < neg.size(); c2++) {
+			
+			InvariantRow &a = Rows[pos[cont]];
+			InvariantRow &b = Rows[neg[c2]];
+			
+			if (isMinimal(a, b, all) == false) {
+				
+				continue;
+			}
+			
+			if (next.size() >= limit) {
+				
+				return false;
+			}
+			
+			next.push_back(InvariantRow());
+			combine(a, b, column, next.back());
+		}
+	}
+	
+	Rows.swap(next);
+	
+	return true;
+}
+
+/**
+ * \brief	Checks if the combination of two rows has a minimal support.
+ * 
+ * \fn		bool PNinvariants::isMinimal(InvariantRow &a, InvariantRow &b,
+ * 															vector<int> &rows)
+ * \param	a: the row where the column is positive.
+ * \param	b: the row where the column is negative.
+ * \param	rows: the rows to compare with.
+ * \return	<b>false</b> if a row other than <i>a</i> and <i>b</i> has its
+ * 			support inside the union of theirs. <b>true</b> otherwise.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool PNinvariants::isMinimal(InvariantRow &a, InvariantRow &b,
+															vector<int> &rows)
+{
+	int words = a.support.size();
+	vector<unsigned long> u(words);
+	int cont, w;
+	
+	for (w = 0; w < words; w++) {
+		
+		u[w] = a.support[w] | b.support[w];
+	}
+	
+	for (cont = 0; cont < rows.size(); cont++) {
+		
+		InvariantRow &r = Rows[rows[cont]];
+		
+		if (&r == &a || &r == &b) {
+			
+			continue;
+		}
+		
+		for (w = 0; w < words && (r.support[w] & ~u[w]) == 0; w++) {
+			
+			// in this case do nothing
+		}
+		
+		if (w == words) {
+			
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+/**
+ * \brief	Combines two rows to make a column zero.
+ * 
+ * \fn		void PNinvariants::combine(InvariantRow &a, InvariantRow &b,
+ * 											int column, InvariantRow &r)
+ * \param	a: the row where the column is positive.
+ * \param	b: the row where the column is negative.
+ * \param	column: the column.
+ * \param	r: where the new row is written, divided by the greatest common
+ * 			divisor of its weights.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PNinvariants::combine(InvariantRow &a, InvariantRow &b, int column,
+															InvariantRow &r)
+{
+	long fa = -get(b, column);
+	long fb = get(a, column);
+	long g = 0;
+	int i, j, c;
+	
+	// the weights: both rows are positive, so nothing cancels
+	for (i = 0, j = 0; i < a.nodes.size() || j < b.nodes.size(); ) {
+		
+		if (j == b.nodes.size() \
+			|| (i < a.nodes.size() && a.nodes[i] < b.nodes[j])) {
+			
+			r.nodes.push_back(a.nodes[i]);
+			r.weights.push_back(fa * a.weights[i++]);
+		} else if (i == a.nodes.size() || b.nodes[j] < a.nodes[i]) {
+			
+			r.nodes.push_back(b.nodes[j]);
+			r.weights.push_back(fb * b.weights[j++]);
+		} else {
+			
+			r.nodes.push_back(a.nodes[i]);
+			r.weights.push_back(fa * a.weights[i++] + fb * b.weights[j++]);
+		}
+		
+		g = gcd(g, r.weights.back());
+	}
+	
+	for (i = 0, j = 0; i < a.columns.size() || j < b.columns.size(); ) {
+		
+		long v;
+		
+		if (j == b.columns.size() \
+			|| (i < a.columns.size() && a.columns[i] < b.columns[j])) {
+			
+			c = a.columns[i];
+			v = fa * a.values[i++];
+		} else if (i == a.columns.size() || b.columns[j] < a.columns[i]) {
+			
+			c = b.columns[j];
+			v = fb * b.values[j++];
+		} else {
+			
+			c = a.columns[i];
+			v = fa * a.values[i++] + fb * b.values[j++];
+		}
+		
+		if (v != 0) {
+			
+			r.columns.push_back(c);
+			r.values.push_back(v);
+		}
+	}
+	
+	// the values are the weights times the incidence matrix, so g divides
+	// them too
+	for (i = 0; i < r.weights.size(); i++) {
+		
+		r.weights[i] /= g;
+	}
+	
+	for (i = 0; i < r.values.size(); i++) {
+		
+		r.values[i] /= g;
+	}
+	
+	r.support.resize(a.support.size());
+	
+	for (i = 0; i < a.support.size(); i++) {
+		
+		r.support[i] = a.support[i] | b.support[i];
+	}
+}
+
+/**
+ * \brief	Gets the value of a column in a row.
+ * 
+ * \fn		static long PNinvariants::get(InvariantRow &r, int column)
+ * \param	r: the row.
+ * \param	column: the column.
+ * \return	The value, zero if it is not in the row.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+long PNinvariants::get(InvariantRow &r, int column)
+{
+	vector<int>::iterator i = \
+		lower_bound(r.columns.begin(), r.columns.end(), column);
+	
+	if (i == r.columns.end() || *i != column) {
+		
+		return 0;
+	}
+	
+	return r.values[i - r.columns.begin()];
+}
+
+/**
+ * \brief	Gets the greatest common divisor of two numbers.
+ * 
+ * \fn		static long PNinvariants::gcd(long a, long b)
+ * \param	a: a number, not negative.
+ * \param	b: a number, not negative.
+ * \return	The greatest common divisor. <i>a</i> if <i>b</i> is zero.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+long PNinvariants::gcd(long a, long b)
+{
+	while (b != 0) {
+		
+		long r = a % b;
+		
+		a = b;
+		b = r;
+	}
+	
+	return a;
+}
@@ -0,0 +1,149 @@
+/**
+ * \file		petri/PNinvariants.h
+ * \brief		The definition of the <b>PNinvariants</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ * 
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include "PNmatrix.h"
+#include "PNmodel.h"
+
+#include <ostream>
+#include <vector>
+
+#ifndef PNINVARIANTS_H
+#define PNINVARIANTS_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFINES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** The default maximum number of rows kept by the elimination. */
+#define _INVARIANTS_MAX_ROWS					10000
+
+/**
+ * \struct	InvariantRow PNinvariants.h
+ * \brief	A row of the elimination of <b>PNinvariants</b>.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * A vector <i>y</i> over the nodes, with no negative weight, and the
+ * entries of <i>y</i> times the incidence matrix (or its transpose) on the
+ * columns not eliminated yet. Both are sparse and sorted.
+ */
+struct InvariantRow {
+	
+	/** The nodes with a weight in <i>y</i>. */
+	vector<int> nodes;
+	
+	/** Their weights. */
+	vector<long> weights;
+	
+	/** The columns with a value. */
+	vector<int> columns;
+	
+	/** Their values. */
+	vector<long> values;
+	
+	/** The nodes of <i>y</i>, one bit each. */
+	vector<unsigned long> support;
+};
+
+/**
+ * \class	PNinvariants PNinvariants.h
+ * \brief	The <b>PNinvariants</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>PNinvariants</b> class. Computes the minimal support semi-positive
+ * invariants of a Petri net: the P-invariants <i>y</i> with
+ * <i>y</i>&middot;<i>C</i> = 0, whose weighted sum of tokens is the same in
+ * every reachable marking, or the T-invariants <i>x</i> with
+ * <i>C</i>&middot;<i>x</i> = 0, the firing counts that come back to the same
+ * marking.
+ * 
+ * It is the Farkas algorithm over the sparse rows of a <b>PNmatrix</b>. The
+ * rows start as the identity and each step eliminates one column of the
+ * incidence matrix, adding each row where it is positive to each row where
+ * it is negative. The number of rows is kept down by:
+ * 	-#	eliminating first the column that adds the fewest rows;
+ * 	-#	keeping a new row only if no other row has its support inside the
+ * 		union of the supports of the two rows combined. Otherwise it is not
+ * 		minimal, and neither is anything made from it;
+ * 	-#	dividing each row by the greatest common divisor of its weights.
+ * 
+ * The rows can still grow exponentially, so the elimination stops at a
+ * maximum (see <code>setLimit()</code>).
+ */
+class PNinvariants {
+	
+	public:
+		
+		PNinvariants(PNmatrix *matrix, int type);
+		~PNinvariants();
+		
+		void setLimit(int rows);
+		
+		bool compute();
+		
+		int size();
+		const vector<int> & getNodes(int i);
+		const vector<long> & getWeights(int i);
+		bool isCovered();
+		
+		void write(ostream &out, PNmodel *net);
+		
+	private:
+		
+		/** The incidence matrix. */
+		PNmatrix *Matrix;
+		
+		/** <code>_PN_P</code> for P-invariants, <code>_PN_T</code> for
+		 *  T-invariants. */
+		int type;
+		
+		/** The maximum number of rows. */
+		int limit;
+		
+		/** If the last <code>compute()</code> found all the invariants. */
+		bool complete;
+		
+		/** The rows of the elimination, and the invariants after it. */
+		vector<InvariantRow> Rows;
+		
+		void setRows();
+		int nextColumn();
+		bool eliminate(int column);
+		bool isMinimal(InvariantRow &a, InvariantRow &b, vector<int> &rows);
+		void combine(InvariantRow &a, InvariantRow &b, int column,
+														InvariantRow &r);
+		static long get(InvariantRow &r, int column);
+		static long gcd(long a, long b);
+		
+		PNinvariants(const PNinvariants &);
+		PNinvariants & operator=(const PNinvariants &);
+};
+
+#endif /* PNINVARIANTS_H */
@@ -0,0 +1,632 @@
+/**
+ * \file		petri/PNmatrix.cpp
+ * \brief		The methods of the <b>PNmatrix</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ * 
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "PNmatrix.h"
+
+#include <algorithm>
+
+#include <assert.h>
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new <b>PNmatrix</b> element.
+ * 
+ * \fn		PNmatrix::PNmatrix(PNmodel *net)
+ * \param	*net: the Petri net. It is only read, and later changes to it
+ * 			are not seen by the matrix.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+PNmatrix::PNmatrix(PNmodel *net)
+{
+	int places = net->getPlaces().size();
+	int transitions = net->getTransitions().size();
+	int p, t, c;
+	
+	vector<vector<int> > rows(transitions);
+	
+	for (p = 0; p < places; p++) {
+		
+		Marking.push_back(net->getTokens(p));
+		
+		const vector<int> &out = net->getOutPlaces(p);
+		
+		for (c = 0; c < out.size(); c++) {
+			
+			rows[out[c]].push_back(p);
+		}
+	}
+	
+	compress(rows, PreFirst, PrePlace, PreWeight);
+	
+	for (t = 0; t < transitions; t++) {
+		
+		rows[t] = net->getOutTransitions(t);
+	}
+	
+	compress(rows, PostFirst, PostPlace, PostWeight);
+	
+	// the columns of the incidence matrix: Post - Pre, merging the two
+	// sorted rows of each transition
+	EffectFirst.push_back(0);
+	
+	for (t = 0; t < transitions; t++) {
+		
+		int i = PreFirst[t];
+		int o = PostFirst[t];
+		
+		while (i < PreFirst[t + 1] || o < PostFirst[t + 1]) {
+			
+			int place, value;
+			
+			if (o == PostFirst[t + 1] \
+				|| (i < PreFirst[t + 1] && PrePlace[i] < PostPlace[o])) {
+				
+				place = PrePlace[i];
+				value = -PreWeight[i++];
+			} else if (i == PreFirst[t + 1] || PostPlace[o] < PrePlace[i]) {
+				
+				place = PostPlace[o];
+				value = PostWeight[o++];
+			} else {
+				
+				place = PrePlace[i];
+				value = PostWeight[o++] - PreWeight[i++];
+			}
+			
+			if (value != 0) {
+				
+				EffectPlace.push_back(place);
+				EffectValue.push_back(value);
+			}
+		}
+		
+		EffectFirst.push_back(EffectPlace.size());
+	}
+	
+	transpose(EffectFirst, EffectPlace, EffectValue, places, IncidenceFirst, \
+		IncidenceTransition, IncidenceValue);
+	
+	vector<int> weights;
+	
+	transpose(PreFirst, PrePlace, PreWeight, places, OutFirst, \
+		OutTransition, weights);
+}
+
+/**
+ * \brief	Class destructor.
+ * 
+ * \fn		PNmatrix::~PNmatrix()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+PNmatrix::~PNmatrix()
+{}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Gets the number of places.
+ * 
+ * \fn		int PNmatrix::getPlaces()
+ * \return	The number of places.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getPlaces()
+{
+	return Marking.size();
+}
+
+/**
+ * \brief	Gets the number of transitions.
+ * 
+ * \fn		int PNmatrix::getTransitions()
+ * \return	The number of transitions.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getTransitions()
+{
+	return PreFirst.size() - 1;
+}
+
+/**
+ * \brief	Gets the initial marking.
+ * 
+ * \fn		const vector<int> & PNmatrix::getMarking()
+ * \return	The tokens of each place at the beginning.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const vector<int> & PNmatrix::getMarking()
+{
+	return Marking;
+}
+
+/**
+ * \brief	Gets the first input place of a transition.
+ * 
+ * \fn		int PNmatrix::getFirstPre(int t)
+ * \param	t: the transition.
+ * \return	The first entry of <i>t</i>. Its entries go up to
+ * 			<code>getLastPre()</code> (excluded).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getFirstPre(int t)
+{
+	assert(t >= 0 && t < getTransitions());
+	
+	return PreFirst[t];
+}
+
+/**
+ * \brief	Gets the entry after the last input place of a transition.
+ * 
+ * \fn		int PNmatrix::getLastPre(int t)
+ * \param	t: the transition.
+ * \return	The first entry of the next transition.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getLastPre(int t)
+{
+	assert(t >= 0 && t < getTransitions());
+	
+	return PreFirst[t + 1];
+}
+
+/**
+ * \brief	Gets the place of an entry of <b>Pre</b>.
+ * 
+ * \fn		int PNmatrix::getPrePlace(int e)
+ * \param	e: the entry.
+ * \return	The place.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getPrePlace(int e)
+{
+	return PrePlace[e];
+}
+
+/**
+ * \brief	Gets the weight of an entry of <b>Pre</b>.
+ * 
+ * \fn		int PNmatrix::getPreWeight(int e)
+ * \param	e: the entry.
+ * \return	The tokens it takes from the place.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getPreWeight(int e)
+{
+	return PreWeight[e];
+}
+
+/**
+ * \brief	Gets the first output place of a transition.
+ * 
+ * \fn		int PNmatrix::getFirstPost(int t)
+ * \param	t: the transition.
+ * \return	The first entry of <i>t</i>. Its entries go up to
+ * 			<code>getLastPost()</code> (excluded).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getFirstPost(int t)
+{
+	assert(t >= 0 && t < getTransitions());
+	
+	return PostFirst[t];
+}
+
+/**
+ * \brief	Gets the entry after the last output place of a transition.
+ * 
+ * \fn		int PNmatrix::getLastPost(int t)
+ * \param	t: the transition.
+ * \return	The first entry of the next transition.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getLastPost(int t)
+{
+	assert(t >= 0 && t < getTransitions());
+	
+	return PostFirst[t + 1];
+}
+
+/**
+ * \brief	Gets the place of an entry of <b>Post</b>.
+ * 
+ * \fn		int PNmatrix::getPostPlace(int e)
+ * \param	e: the entry.
+ * \return	The place.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getPostPlace(int e)
+{
+	return PostPlace[e];
+}
+
+/**
+ * \brief	Gets the weight of an entry of <b>Post</b>.
+ * 
+ * \fn		int PNmatrix::getPostWeight(int e)
+ * \param	e: the entry.
+ * \return	The tokens it puts in the place.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getPostWeight(int e)
+{
+	return PostWeight[e];
+}
+
+/**
+ * \brief	Gets the first place changed by a transition.
+ * 
+ * \fn		int PNmatrix::getFirstEffect(int t)
+ * \param	t: the transition.
+ * \return	The first entry of <i>t</i>. Its entries go up to
+ * 			<code>getLastEffect()</code> (excluded).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getFirstEffect(int t)
+{
+	assert(t >= 0 && t < getTransitions());
+	
+	return EffectFirst[t];
+}
+
+/**
+ * \brief	Gets the entry after the last place changed by a transition.
+ * 
+ * \fn		int PNmatrix::getLastEffect(int t)
+ * \param	t: the transition.
+ * \return	The first entry of the next transition.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getLastEffect(int t)
+{
+	assert(t >= 0 && t < getTransitions());
+	
+	return EffectFirst[t + 1];
+}
+
+/**
+ * \brief	Gets the place of an entry of <b>Effect</b>.
+ * 
+ * \fn		int PNmatrix::getEffectPlace(int e)
+ * \param	e: the entry.
+ * \return	The place.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getEffectPlace(int e)
+{
+	return EffectPlace[e];
+}
+
+/**
+ * \brief	Gets the value of an entry of <b>Effect</b>.
+ * 
+ * \fn		int PNmatrix::getEffectValue(int e)
+ * \param	e: the entry.
+ * \return	The change of the tokens of the place when it fires.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getEffectValue(int e)
+{
+	return EffectValue[e];
+}
+
+/**
+ * \brief	Gets the first transition that changes a place.
+ * 
+ * \fn		int PNmatrix::getFirstIncidence(int p)
+ * \param	p: the place.
+ * \return	The first entry of <i>p</i>. Its entries go up to
+ * 			<code>getLastIncidence()</code> (excluded).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getFirstIncidence(int p)
+{
+	assert(p >= 0 && p < getPlaces());
+	
+	return IncidenceFirst[p];
+}
+
+/**
+ * \brief	Gets the entry after the last transition that changes a place.
+ * 
+ * \fn		int PNmatrix::getLastIncidence(int p)
+ * \param	p: the place.
+ * \return	The first entry of the next place.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getLastIncidence(int p)
+{
+	assert(p >= 0 && p < getPlaces());
+	
+	return IncidenceFirst[p + 1];
+}
+
+/**
+ * \brief	Gets the transition of an entry of <b>Incidence</b>.
+ * 
+ * \fn		int PNmatrix::getIncidenceTransition(int e)
+ * \param	e: the entry.
+ * \return	The transition.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getIncidenceTransition(int e)
+{
+	return IncidenceTransition[e];
+}
+
+/**
+ * \brief	Gets the value of an entry of <b>Incidence</b>.
+ * 
+ * \fn		int PNmatrix::getIncidenceValue(int e)
+ * \param	e: the entry.
+ * \return	The change of the tokens of the place when it fires.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getIncidenceValue(int e)
+{
+	return IncidenceValue[e];
+}
+
+/**
+ * \brief	Gets the first output transition of a place.
+ * 
+ * \fn		int PNmatrix::getFirstOut(int p)
+ * \param	p: the place.
+ * \return	The first entry of <i>p</i>. Its entries go up to
+ * 			<code>getLastOut()</code> (excluded).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getFirstOut(int p)
+{
+	assert(p >= 0 && p < getPlaces());
+	
+	return OutFirst[p];
+}
+
+/**
+ * \brief	Gets the entry after the last output transition of a place.
+ * 
+ * \fn		int PNmatrix::getLastOut(int p)
+ * \param	p: the place.
+ * \return	The first entry of the next place.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getLastOut(int p)
+{
+	assert(p >= 0 && p < getPlaces());
+	
+	return OutFirst[p + 1];
+}
+
+/**
+ * \brief	Gets the transition of an entry of <b>Out</b>.
+ * 
+ * \fn		int PNmatrix::getOutTransition(int e)
+ * \param	e: the entry.
+ * \return	The transition.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmatrix::getOutTransition(int e)
+{
+	return OutTransition[e];
+}
+
+/**
+ * \brief	Checks if a transition can fire.
+ * 
+ * \fn		bool PNmatrix::isEnabled(int t, const vector<int> &m)
+ * \param	t: the transition.
+ * \param	m: the marking.
+ * \return	<b>true</b> if every input place of <i>t</i> has the tokens it
+ * 			takes in <i>m</i>. <b>false</b> otherwise.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool PNmatrix::isEnabled(int t, const vector<int> &m)
+{
+	for (int e = PreFirst[t]; e < PreFirst[t + 1]; e++) {
+		
+		if (m[PrePlace[e]] < PreWeight[e]) {
+			
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+/**
+ * \brief	Fires a transition.
+ * 
+ * \fn		void PNmatrix::fire(int t, vector<int> &m)
+ * \param	t: the transition. It must be enabled in <i>m</i>.
+ * \param	m: the marking, changed to the one reached.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PNmatrix::fire(int t, vector<int> &m)
+{
+	for (int e = EffectFirst[t]; e < EffectFirst[t + 1]; e++) {
+		
+		m[EffectPlace[e]] += EffectValue[e];
+	}
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PRIVATE METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Compresses rows of nodes.
+ * 
+ * \fn		void PNmatrix::compress(vector<vector<int> > &rows,
+ * 					vector<int> &first, vector<int> &node, vector<int> &weight)
+ * \param	rows: the nodes of each row, in any order and maybe repeated.
+ * 			They are sorted.
+ * \param	first: where the first entry of each row is written, plus the
+ * 			end of the last one.
+ * \param	node: where the nodes are written.
+ * \param	weight: where the number of times each node is in its row is
+ * 			written.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PNmatrix::compress(vector<vector<int> > &rows, vector<int> &first,
+								vector<int> &node, vector<int> &weight)
+{
+	first.assign(1, 0);
+	node.clear();
+	weight.clear();
+	
+	for (int r = 0; r < rows.size(); r++) {
+		
+		sort(rows[r].begin(), rows[r].end());
+		
+		for (int c = 0; c < rows[r].size(); c++) {
+			
+			if (c > 0 && rows[r][c] == rows[r][c - 1]) {
+				
+				weight.back()++;
+			} else {
+				
+				node.push_back(rows[r][c]);
+				weight.push_back(1);
+			}
+		}
+		
+		first.push_back(node.size());
+	}
+}
+
+/**
+ * \brief	Transposes compressed rows.
+ * 
+ * \fn		void PNmatrix::transpose(vector<int> &first, vector<int> &node,
+ * 						vector<int> &value, int columns, vector<int> &tfirst,
+ * 						vector<int> &tnode, vector<int> &tvalue)
+ * \param	first: the first entry of each row, plus the end of the last one.
+ * \param	node: the column of each entry.
+ * \param	value: the value of each entry.
+ * \param	columns: the number of columns.
+ * \param	tfirst: where the first entry of each column is written, plus
+ * 			the end of the last one.
+ * \param	tnode: where the row of each entry is written.
+ * \param	tvalue: where the value of each entry is written.
+ * 
+ * The entries are counted and then put in their place, so each column is
+ * sorted by the rows without sorting anything.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PNmatrix::transpose(vector<int> &first, vector<int> &node,
+						vector<int> &value, int columns, vector<int> &tfirst,
+						vector<int> &tnode, vector<int> &tvalue)
+{
+	int r, e;
+	
+	tfirst.assign(columns + 1, 0);
+	tnode.resize(node.size());
+	tvalue.resize(node.size());
+	
+	for (e = 0; e < node.size(); e++) {
+		
+		tfirst[node[e] + 1]++;
+	}
+	
+	for (r = 0; r < columns; r++) {
+		
+		tfirst[r + 1] += tfirst[r];
+	}
+	
+	vector<int> next(tfirst.begin(), tfirst.end() - 1);
+	
+	for (r = 0; r + 1 < first.size(); r++) {
+		
+		for (e = first[r]; e < first[r + 1]; e++) {
+			
+			tnode[next[node[e]]] = r;
+			tvalue[next[node[e]]++] = value[e];
+		}
+	}
+}
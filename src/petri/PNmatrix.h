@@ -0,0 +1,146 @@
+/**
+ * \file		petri/PNmatrix.h
+ * \brief		The definition of the <b>PNmatrix</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ * 
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include "PNmodel.h"
+
+#include <vector>
+
+#ifndef PNMATRIX_H
+#define PNMATRIX_H
+
+/**
+ * \class	PNmatrix PNmatrix.h
+ * \brief	The <b>PNmatrix</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>PNmatrix</b> class. A read only copy of a <b>PNmodel</b> in
+ * compressed rows, to be built once the net is complete and used by the
+ * analyses that look at every arc many times (the token game, the
+ * reachability graph, the invariants).
+ * 
+ * Places and transitions keep the targets they have in the model. Each one
+ * has a row of entries, and the entries of the node <i>n</i> are the ones
+ * from <code>getFirst...(n)</code> to <code>getLast...(n)</code>
+ * (excluded), sorted by the other node and with the parallel arcs merged
+ * into a weight:
+ * 	-#	<b>Pre</b> and <b>Post</b>: the input and output places of each
+ * 		transition, with the tokens it takes from and puts in them;
+ * 	-#	<b>Effect</b>: the columns of the incidence matrix, that is the
+ * 		places whose tokens change when each transition fires, with the
+ * 		change. A place that is only read is not there;
+ * 	-#	<b>Incidence</b>: the rows of the incidence matrix, that is the
+ * 		transitions that change the tokens of each place, with the change;
+ * 	-#	<b>Out</b>: the transitions that take tokens from each place.
+ */
+class PNmatrix {
+	
+	public:
+		
+		PNmatrix(PNmodel *net);
+		~PNmatrix();
+		
+		int getPlaces();
+		int getTransitions();
+		const vector<int> & getMarking();
+		
+		int getFirstPre(int t);
+		int getLastPre(int t);
+		int getPrePlace(int e);
+		int getPreWeight(int e);
+		
+		int getFirstPost(int t);
+		int getLastPost(int t);
+		int getPostPlace(int e);
+		int getPostWeight(int e);
+		
+		int getFirstEffect(int t);
+		int getLastEffect(int t);
+		int getEffectPlace(int e);
+		int getEffectValue(int e);
+		
+		int getFirstIncidence(int p);
+		int getLastIncidence(int p);
+		int getIncidenceTransition(int e);
+		int getIncidenceValue(int e);
+		
+		int getFirstOut(int p);
+		int getLastOut(int p);
+		int getOutTransition(int e);
+		
+		bool isEnabled(int t, const vector<int> &m);
+		void fire(int t, vector<int> &m);
+		
+	private:
+		
+		/** The initial marking. */
+		vector<int> Marking;
+		
+		/** The first entry of each transition in <code>Pre...</code>, plus
+		 *  the end of the last one. */
+		vector<int> PreFirst;
+		
+		/** The input places of the transitions and their weights. */
+		vector<int> PrePlace, PreWeight;
+		
+		/** The first entry of each transition in <code>Post...</code>. */
+		vector<int> PostFirst;
+		
+		/** The output places of the transitions and their weights. */
+		vector<int> PostPlace, PostWeight;
+		
+		/** The first entry of each transition in <code>Effect...</code>. */
+		vector<int> EffectFirst;
+		
+		/** The columns of the incidence matrix. */
+		vector<int> EffectPlace, EffectValue;
+		
+		/** The first entry of each place in <code>Incidence...</code>. */
+		vector<int> IncidenceFirst;
+		
+		/** The rows of the incidence matrix. */
+		vector<int> IncidenceTransition, IncidenceValue;
+		
+		/** The first entry of each place in <code>OutTransition</code>. */
+		vector<int> OutFirst;
+		
+		/** The output transitions of the places. */
+		vector<int> OutTransition;
+		
+		void compress(vector<vector<int> > &rows, vector<int> &first,
+						vector<int> &node, vector<int> &weight);
+		void transpose(vector<int> &first, vector<int> &node,
+						vector<int> &value, int columns, vector<int> &tfirst,
+						vector<int> &tnode, vector<int> &tvalue);
+		
+		PNmatrix(const PNmatrix &);
+		PNmatrix & operator=(const PNmatrix &);
+};
+
+#endif /* PNMATRIX_H */
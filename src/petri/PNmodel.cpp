@@ -45,7 +45,8 @@ PNmodel::PNmodel()
 {}
 
 /**
- * \brief	Class destructor.
+ * \brief	Class destructor. The places and transitions are freed with their
+ * 			pools.
  * 
  * \fn		PNmodel::~PNmodel()
  * 
@@ -114,6 +115,22 @@ string PNmodel::getTransitionLabel(int t)
 	return T[t]->getLabel();
 }
 
+/**
+ * \brief	Gets the type of a transition.
+ * 
+ * \fn		int PNmodel::getTransitionType(int t)
+ * \param	t: the target of the transition.
+ * \return	The type of the transition (<code>_PN_T_OUTPUTS</code>,
+ * 			<code>_PN_T_INTERNAL</code> or <code>_PN_T_DUMMY</code>).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmodel::getTransitionType(int t)
+{
+	return T[t]->getType();
+}
+
 /**
  * \brief	Gets all places of the system.
  * 
@@ -230,14 +247,14 @@ void PNmodel::setLabel(string l)
 /**
  * \brief	Gets all all output transitions of a place.
  * 
- * \fn		vector<int> PNmodel::getOutPlaces(int t)
+ * \fn		const vector<int> & PNmodel::getOutPlaces(int t)
  * \param	t: the target of the place.
  * \return	a vector of all output transitions of place <code>t</code>.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	13/01/2005
  */
-vector<int> PNmodel::getOutPlaces(int t)
+const vector<int> & PNmodel::getOutPlaces(int t)
 {
 	#ifdef _JABUTI_CODE_DEBBUGING
 		cerr << __FILE__ << ": " << __LINE__ << "  getOutPlaces()" << endl;
@@ -249,14 +266,14 @@ vector<int> PNmodel::getOutPlaces(int t)
 /**
  * \brief	Gets all all output places of a transition.
  * 
- * \fn		vector<int> PNmodel::getOutTransitions(int t)
+ * \fn		const vector<int> & PNmodel::getOutTransitions(int t)
  * \param	t: the target of the transition.
  * \return	a vector of all output places of transition <code>t</code>.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	13/01/2005
  */
-vector<int> PNmodel::getOutTransitions(int t)
+const vector<int> & PNmodel::getOutTransitions(int t)
 {
 	#ifdef _JABUTI_CODE_DEBBUGING
 		cerr << __FILE__ << ": " << __LINE__ << "  getOutTransitions()" << endl;
@@ -313,6 +330,8 @@ void PNmodel::setLabel(const char *l)
  * \param	l: the label of the place.
  * \param	n: the amount of tokens to store on the place.
  * 
+ * Nothing is done if there is no place labelled <i>l</i>.
+ * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	13/01/2005
  */
@@ -324,7 +343,10 @@ void PNmodel::setTokens(string l, int n)
 	
 	int p = existsPlace(l);
 	
-	P[p]->setTokens(n);
+	if (p != _PN_ERROR_CODE_NOT_FOUND) {
+		
+		P[p]->setTokens(n);
+	}
 		
 	#ifdef _JABUTI_CODE_DEBBUGING
 		cerr << __FILE__ << ": " << __LINE__ << " /setTokens()" << endl;
@@ -354,6 +376,27 @@ void PNmodel::setTokens(int t, int n)
 	#endif
 }
 
+/**
+ * \brief	Makes room for the nodes of a large net.
+ * 
+ * \fn		void PNmodel::reserve(int places, int transitions)
+ * \param	places: the number of places the net will have.
+ * \param	transitions: the number of transitions the net will have.
+ * 
+ * Nothing changes in the net, but its nodes are inserted without growing
+ * the vectors and rehashing the labels.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PNmodel::reserve(int places, int transitions)
+{
+	P.reserve(places);
+	PlaceNames.reserve(places);
+	T.reserve(transitions);
+	TransitionNames.reserve(transitions);
+}
+
 /**
  * \brief	Insert an arc linking a place and a transition.
  * 
@@ -399,6 +442,28 @@ void PNmodel::insertArc(int src, int dest, int stype)
 	#endif
 }
 
+/**
+ * \brief	Inserts a list of arcs, all of them leaving the same kind of node.
+ * 
+ * \fn		void PNmodel::insertArcs(const vector<int> &src, \
+ * 			const vector<int> &dest, int stype)
+ * \param	&src: the targets of the source nodes.
+ * \param	&dest: the targets of the destination nodes, in the order of
+ * 			<i>src</i>.
+ * \param	stype: type of the source nodes, as in <code>insertArc()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PNmodel::insertArcs(const vector<int> &src, const vector<int> &dest, \
+	int stype)
+{
+	for (int c = 0; c < src.size() && c < dest.size(); c++) {
+		
+		insertArc(src[c], dest[c], stype);
+	}
+}
+
 /**
  * \brief	Inserts a new place in the Petri net.
  * 
@@ -416,11 +481,12 @@ int PNmodel::insertPlace(string l)
 		cerr << __FILE__ << ": " << __LINE__ << "  insertPlace()" << endl;
 	#endif
 	
-	Place *paux = new Place(l, P.size());
+	Place *paux = new (PlacePool.allocate()) Place(l, P.size());
 	
 	if (paux != NULL) {
 		
 		P.push_back(paux);
+		PlaceNames.insert(make_pair(l, P.back()->getTarget()));
 		
 		#ifdef _JABUTI_CODE_DEBBUGING
 			cerr << __FILE__ << ": " << __LINE__ << " /insertPlace()" << endl;
@@ -436,6 +502,36 @@ int PNmodel::insertPlace(string l)
 	return _PN_ERROR_CODE_NOT_INSERTED;
 }
 
+/**
+ * \brief	Inserts a list of new places in the Petri net.
+ * 
+ * \fn		int PNmodel::insertPlaces(const vector<string> &l, \
+ * 			const vector<int> &n)
+ * \param	&l: the labels of the new places.
+ * \param	&n: the tokens of the new places, in the order of <i>l</i>. The
+ * 			places after its end have no tokens.
+ * \return	the target of the first inserted place. The next ones follow it.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmodel::insertPlaces(const vector<string> &l, const vector<int> &n)
+{
+	int first = P.size();
+	
+	for (int c = 0; c < l.size(); c++) {
+		
+		int p = insertPlace(l[c]);
+		
+		if (c < n.size()) {
+			
+			P[p]->setTokens(n[c]);
+		}
+	}
+	
+	return first;
+}
+
 /**
  * \brief	Inserts a new transition in the Petri net.
  * 
@@ -454,11 +550,13 @@ int PNmodel::insertTransition(string l, int t)
 		cerr << __FILE__ << ": " << __LINE__ << "  insertTransition()" << endl;
 	#endif
 	
-	Transition *taux = new Transition(l, t, T.size());
+	Transition *taux = \
+		new (TransitionPool.allocate()) Transition(l, t, T.size());
 	
 	if (taux != NULL) {
 		
 		T.push_back(taux);
+		TransitionNames.insert(make_pair(l, T.back()->getTarget()));
 		
 		#ifdef _JABUTI_CODE_DEBBUGING
 			cerr << __FILE__ << ": " << __LINE__ << " /insertT()" << endl;
@@ -474,6 +572,31 @@ int PNmodel::insertTransition(string l, int t)
 	return _PN_ERROR_CODE_NOT_INSERTED;
 }
 
+/**
+ * \brief	Inserts a list of new transitions of the same type in the Petri
+ * 			net.
+ * 
+ * \fn		int PNmodel::insertTransitions(const vector<string> &l, int t)
+ * \param	&l: the labels of the new transitions.
+ * \param	t: the type (internal, output, etc.) of the new transitions.
+ * \return	the target of the first inserted transition. The next ones
+ * 			follow it.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int PNmodel::insertTransitions(const vector<string> &l, int t)
+{
+	int first = T.size();
+	
+	for (int c = 0; c < l.size(); c++) {
+		
+		insertTransition(l[c], t);
+	}
+	
+	return first;
+}
+
 /**
  * \brief	Checks if a given place was already inserted.
  * 
@@ -491,16 +614,15 @@ int PNmodel::existsPlace(string l)
 		cerr << __FILE__ << ": " << __LINE__ << "  existsPlace()" << endl;
 	#endif
 	
-	for (int i = 0; i < P.size(); i++) {
+	unordered_map<string, int>::iterator i = PlaceNames.find(l);
+	
+	if (i != PlaceNames.end()) {
 		
-		if (P[i]->getLabel() == l) {
-			
-			#ifdef _JABUTI_CODE_DEBBUGING
-				cerr << __FILE__ << ": " << __LINE__ << " /existsPlace()" << endl;
-			#endif
-			
-			return i;
-		}
+		#ifdef _JABUTI_CODE_DEBBUGING
+			cerr << __FILE__ << ": " << __LINE__ << " /existsPlace()" << endl;
+		#endif
+		
+		return i->second;
 	}
 	
 	#ifdef _JABUTI_CODE_DEBBUGING
@@ -527,16 +649,15 @@ int PNmodel::existsTransition(string l)
 		cerr << __FILE__ << ": " << __LINE__ << "  existsTransition()" << endl;
 	#endif
 	
-	for (int i = 0; i < T.size(); i++) {
+	unordered_map<string, int>::iterator i = TransitionNames.find(l);
+	
+	if (i != TransitionNames.end()) {
 		
-		if (T[i]->getLabel() == l) {
-			
-			#ifdef _JABUTI_CODE_DEBBUGING
-				cerr << __FILE__ << ": " << __LINE__ << " /existsTransition()" << endl;
-			#endif
-			
-			return i;
-		}
+		#ifdef _JABUTI_CODE_DEBBUGING
+			cerr << __FILE__ << ": " << __LINE__ << " /existsTransition()" << endl;
+		#endif
+		
+		return i->second;
 	}
 	
 	#ifdef _JABUTI_CODE_DEBBUGING
@@ -563,33 +684,129 @@ int PNmodel::typeOf(string l)
 		cerr << __FILE__ << ": " << __LINE__ << "  typeOf()" << endl;
 	#endif
 	
-	for (int i = 0; i < T.size(); i++) {
+	if (TransitionNames.count(l) > 0) {
+		
+		#ifdef _JABUTI_CODE_DEBBUGING
+			cerr << __FILE__ << ": " << __LINE__ << " /typeOf()" << endl;
+		#endif
+		
+		return _PN_T;
+	}
+	
+	if (PlaceNames.count(l) > 0) {
+		
+		#ifdef _JABUTI_CODE_DEBBUGING
+			cerr << __FILE__ << ": " << __LINE__ << " /typeOf()" << endl;
+		#endif
 		
-		if (T[i]->getLabel() == l) {
+		return _PN_P;
+	}
+	
+	#ifdef _JABUTI_CODE_DEBBUGING
+		cerr << __FILE__ << ": " << __LINE__ << " /typeOf()" << endl;
+	#endif
+	
+	return _PN_ERROR_CODE_NOT_FOUND;
+}
+
+/**
+ * \brief	Writes the Petri net in the <b>petrify</b> format.
+ * 
+ * \fn		void PNmodel::petrify(ostream &out)
+ * \param	out: where the net is written.
+ * 
+ * The transitions named as instances of an event (<code>e/1</code>,
+ * <code>e/2</code>, ...) are declared only by the event, so its first
+ * transition must be named after it. The places that are not marked and
+ * have no arcs leaving them are listed only as the successors of their
+ * transitions.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void PNmodel::petrify(ostream &out)
+{
+	static const int types[] = {_PN_T_OUTPUTS, _PN_T_INTERNAL, _PN_T_DUMMY};
+	static const char *sections[] = {".outputs", ".internal", ".dummy"};
+	int i, c;
+	
+	out << ".model " << label << "\n";
+	
+	for (i = 0; i < sizeof(types) / sizeof(int); i++) {
+		
+		bool empty = true;
+		
+		for (c = 0; c < T.size(); c++) {
+			
+			if (T[c]->getType() != types[i] \
+				|| T[c]->getLabel().find('/') != string::npos) {
+				
+				continue;
+			}
+			
+			if (empty) {
+				
+				out << sections[i];
+				empty = false;
+			}
 			
-			#ifdef _JABUTI_CODE_DEBBUGING
-				cerr << __FILE__ << ": " << __LINE__ << " /typeOf()" << endl;
-			#endif
+			out << " " << T[c]->getLabel();
+		}
+		
+		if (empty == false) {
 			
-			return _PN_T;
+			out << "\n";
 		}
 	}
 	
-	for (int i = 0; i < P.size(); i++) {
+	out << ".graph\n";
+	
+	for (i = 0; i < T.size(); i++) {
+		
+		const vector<int> &s = T[i]->getOut();
+		
+		out << T[i]->getLabel();
+		
+		for (c = 0; c < s.size(); c++) {
+			
+			out << " " << P[s[c]]->getLabel();
+		}
+		
+		out << "\n";
+	}
+	
+	for (i = 0; i < P.size(); i++) {
 		
-		if (P[i]->getLabel() == l) {
+		const vector<int> &s = P[i]->getOut();
+		
+		if (s.empty()) {
 			
-			#ifdef _JABUTI_CODE_DEBBUGING
-				cerr << __FILE__ << ": " << __LINE__ << " /typeOf()" << endl;
-			#endif
+			continue;
+		}
+		
+		out << P[i]->getLabel();
+		
+		for (c = 0; c < s.size(); c++) {
 			
-			return _PN_P;
+			out << " " << T[s[c]]->getLabel();
 		}
+		
+		out << "\n";
 	}
 	
-	#ifdef _JABUTI_CODE_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /typeOf()" << endl;
-	#endif
+	out << ".marking {";
 	
-	return _PN_ERROR_CODE_NOT_FOUND;
+	for (i = 0; i < P.size(); i++) {
+		
+		if (P[i]->getTokens() == 1) {
+			
+			out << " " << P[i]->getLabel();
+		} else if (P[i]->getTokens() > 1) {
+			
+			out << " " << P[i]->getLabel() << "=" << P[i]->getTokens();
+		}
+	}
+	
+	out << " }\n";
+	out << ".end" << endl;
 }
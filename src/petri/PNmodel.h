@@ -28,9 +28,12 @@ using namespace std;
 #include "config.h"
 
 #include "Place.h"
+#include "Pool.h"
 #include "Transition.h"
 
+#include <ostream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #ifndef PNMODEL_H
@@ -65,6 +68,17 @@ using namespace std;
  * 
  * The <b>PNmodel</b> class. This class defines the data structure to store a
  * <b>Petri Net</b> model in the main memory.
+ * 
+ * The places and transitions are kept in pools owned by the model, and they
+ * are all freed with it. So a model can not be copied: pass a pointer.
+ * 
+ * The model is meant to be built and written. The analyses of a complete
+ * net read it from a <b>PNmatrix</b>.
+ * 
+ * The labels are hashed to their targets, so the nodes can be found by name
+ * in constant time. Large nets can be built from lists of labels and arcs
+ * with <code>reserve()</code>, <code>insertPlaces()</code>,
+ * <code>insertTransitions()</code> and <code>insertArcs()</code>.
  */
 class PNmodel {
 	
@@ -76,11 +90,12 @@ class PNmodel {
 		string getLabel();
 		string getPlaceLabel(int t);
 		string getTransitionLabel(int t);
+		int getTransitionType(int t);
 		vector<int> getPlaces();
 		vector<int> getTransitions();
 		vector<string> getTransitions(int t);
-		vector<int> getOutPlaces(int t);
-		vector<int> getOutTransitions(int t);
+		const vector<int> & getOutPlaces(int t);
+		const vector<int> & getOutTransitions(int t);
 		int getTokens(int t);
 		
 		void setLabel(string l);
@@ -88,15 +103,23 @@ class PNmodel {
 		void setTokens(string l, int n);
 		void setTokens(int t, int n);
 		
+		void reserve(int places, int transitions);
+		
 		void insertArc(int src, int dest, int stype);
+		void insertArcs(const vector<int> &src, const vector<int> &dest, \
+			int stype);
 		int insertPlace(string l);
+		int insertPlaces(const vector<string> &l, const vector<int> &n);
 		int insertTransition(string l, int t);
+		int insertTransitions(const vector<string> &l, int t);
 		
 		int existsPlace(string l);
 		int existsTransition(string l);
 		
 		int typeOf(string l);
 		
+		void petrify(ostream &out);
+		
 	private:
 		
 		/** The set of places. */
@@ -105,8 +128,23 @@ class PNmodel {
 		/** The set of transitions. */
 		vector<Transition *> T;
 		
+		/** The targets of the places, by label. */
+		unordered_map<string, int> PlaceNames;
+		
+		/** The targets of the transitions, by label. */
+		unordered_map<string, int> TransitionNames;
+		
 		/** The label of the model. */
 		string label;
+		
+		/** The memory of the places. */
+		Pool<Place> PlacePool;
+		
+		/** The memory of the transitions. */
+		Pool<Transition> TransitionPool;
+		
+		PNmodel(const PNmodel &);
+		PNmodel & operator=(const PNmodel &);
 };
 
 #endif /* PNMODEL_H */
@@ -123,13 +123,13 @@ int Place::getTokens()
 /**
  * \brief	Gets the targets of all input transitions of the place.
  * 
- * \fn		vector<int> Place::getIn()
+ * \fn		const vector<int> & Place::getIn()
  * \return	a vector with the targets of all input transitions.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	13/01/2005
  */
-vector<int> Place::getIn()
+const vector<int> & Place::getIn()
 {
 	return in;
 }
@@ -137,13 +137,13 @@ vector<int> Place::getIn()
 /**
  * \brief	Gets the targets of all output transitions of the place.
  * 
- * \fn		vector<int> Place::getOut()
+ * \fn		const vector<int> & Place::getOut()
  * \return	a vector with the targets of all output transitions.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	13/01/2005
  */
-vector<int> Place::getOut()
+const vector<int> & Place::getOut()
 {
 	return out;
 }
@@ -183,6 +183,8 @@ bool Place::existsIn(int n)
 			
 			return true;
 		}
+		
+		i++;
 	}
 	
 	return false;
@@ -203,12 +205,14 @@ bool Place::existsOut(int n)
 {
 	vector<int>::iterator i = out.begin();
 	
-	while (i != in.end()) {
+	while (i != out.end()) {
 		
 		if (*i == n) {
 			
 			return true;
 		}
+		
+		i++;
 	}
 	
 	return false;
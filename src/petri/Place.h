@@ -53,8 +53,8 @@ class Place {
 		string getLabel();
 		int getTarget();
 		int getTokens();
-		vector<int> getIn();
-		vector<int> getOut();
+		const vector<int> & getIn();
+		const vector<int> & getOut();
 		
 		void setTokens(int n);
 		
@@ -116,13 +116,13 @@ int Transition::getType()
 /**
  * \brief	Gets the targets of all input places of the transition.
  * 
- * \fn		vector<int> Transition::getIn()
+ * \fn		const vector<int> & Transition::getIn()
  * \return	a vector with the targets of all input places.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	13/01/2005
  */
-vector<int> Transition::getIn()
+const vector<int> & Transition::getIn()
 {
 	return in;
 }
@@ -130,13 +130,13 @@ vector<int> Transition::getIn()
 /**
  * \brief	Gets the targets of all output places of the transition.
  * 
- * \fn		vector<int> Transition::getOut()
+ * \fn		const vector<int> & Transition::getOut()
  * \return	a vector with the targets of all output places.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	13/01/2005
  */
-vector<int> Transition::getOut()
+const vector<int> & Transition::getOut()
 {
 	return out;
 }
@@ -162,6 +162,8 @@ bool Transition::existsIn(int n)
 			
 			return true;
 		}
+		
+		i++;
 	}
 	
 	return false;
@@ -182,12 +184,14 @@ bool Transition::existsOut(int n)
 {
 	vector<int>::iterator i = out.begin();
 	
-	while (i != in.end()) {
+	while (i != out.end()) {
 		
 		if (*i == n) {
 			
 			return true;
 		}
+		
+		i++;
 	}
 	
 	return false;
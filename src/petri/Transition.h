@@ -53,8 +53,8 @@ class Transition {
 		string getLabel();
 		int getTarget();
 		int getType();
-		vector<int> getIn();
-		vector<int> getOut();
+		const vector<int> & getIn();
+		const vector<int> & getOut();
 		
 		bool existsIn(int n);
 		bool existsOut(int n);
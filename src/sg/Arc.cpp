@@ -28,6 +28,11 @@ using namespace std;
 
 #include "Arc.h"
 
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * INITIALIZING CLASS VARIABLES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+EventTable Arc::Events;
+
 /**
  * \brief	Class constructor. Creates a new <b>Arc</b> element.
  * 
@@ -43,7 +48,7 @@ using namespace std;
 Arc::Arc(int src, const char *lab, int dest, int trg)
 {
 	source = src;
-	label = lab;
+	event = Events.insert(lab);
 	destination = dest;
 	//aTarget = nextTarget++;
 	target = trg;
@@ -66,7 +71,7 @@ Arc::Arc(int src, const char *lab, int dest, int trg)
  */
 Arc::Arc(const char *lab, int trg)
 {
-	label = lab;
+	event = Events.insert(lab);
 	//aTarget = nextTarget++;
 	target = trg;
 	IOArc = false;
@@ -116,15 +121,31 @@ int Arc::getDest()
 /**
  * \brief	Gets the label of the arc.
  * 
- * \fn		string Arc::getLabel()
+ * \fn		const string & Arc::getLabel()
  * \return	A string with the label of the arc.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	31/05/2004
  */
-string Arc::getLabel()
+const string & Arc::getLabel()
+{
+	return Events.getLabel(event);
+}
+
+/**
+ * \brief	Gets the event of the arc.
+ * 
+ * \fn		int Arc::getEvent()
+ * \return	An integer identifying the label of the arc in
+ * 			<code>Arc::Events</code>. Two arcs have the same event if and only
+ * 			if they have the same label.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int Arc::getEvent()
 {
-	return label;
+	return event;
 }
 
 /**
@@ -228,8 +249,7 @@ void Arc::setSrc(int trg)
  */
 void Arc::setLabel(const char *lab)
 {
-	string aux = lab;
-	label.swap(aux);
+	event = Events.insert(lab);
 }
 
 /**
@@ -27,6 +27,8 @@ using namespace std;
 
 #include "config.h"
 
+#include "EventTable.h"
+
 #include <string>
 
 #ifndef ARC_H
@@ -67,7 +69,8 @@ class Arc {
 		
 		int getSrc();					/* gets target of source state */
 		int getDest();					/* gets target of destination state */
-		string getLabel();				/* gets label of arc */
+		const string & getLabel();		/* gets label of arc */
+		int getEvent();					/* gets event of arc */
 		int getTarget();				/* gets target of arc */
 		int getIOType();				/* gets io type */
 		int getChannel();				/* gets channel target */
@@ -83,10 +86,13 @@ class Arc {
 		
 		bool isIO();
 		
+		/** The labels of all arcs. */
+		static EventTable Events;
+		
 	private:
 	
-		/** The label of the arc. */
-		string label;
+		/** The event of the arc. Its label is kept in <code>Events</code>. */
+		int event;
 		
 		/** The target of the arc. */
 		int target;
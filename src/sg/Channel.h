@@ -28,6 +28,7 @@ using namespace std;
 
 #include "config.h"
 
+#include <atomic>
 #include <string>
 
 #ifndef CHANNEL_H
@@ -122,7 +123,8 @@ class Channel {
 		 *  */
 		int type;
 		
-		/** Target of the next channel that will be created. */
-		static int nextTarget;
+		/** Target of the next channel that will be created. Atomic, as
+		 *  channels may be created by many threads. */
+		static atomic<int> nextTarget;
 };
 #endif /* CHANNEL_H */
@@ -0,0 +1,183 @@
+/**
+ * \file		sg/EventTable.cpp
+ * \brief		The methods of the <b>EventTable</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ * 
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "EventTable.h"
+
+#include "assert.h"
+
+/**
+ * \brief	Class constructor. Creates a new empty <b>EventTable</b> element.
+ * 
+ * \fn		EventTable::EventTable()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+EventTable::EventTable()
+{
+	Size = 0;
+	
+	for (int cont = 0; cont < _EVENTTABLE_BLOCKS; cont++) {
+		
+		Blocks[cont] = NULL;
+	}
+}
+
+/**
+ * \brief	Class destructor.
+ * 
+ * \fn		EventTable::~EventTable()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+EventTable::~EventTable()
+{
+	for (int cont = 0; cont < _EVENTTABLE_BLOCKS; cont++) {
+		
+		delete [] Blocks[cont];
+	}
+}
+
+/**
+ * \brief	Interns a label.
+ * 
+ * \fn		int EventTable::insert(const string &lab)
+ * \param	lab: the label.
+ * \return	The event of <i>lab</i>. A new event is created only if the label
+ * 			was not in the table.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int EventTable::insert(const string &lab)
+{
+	lock_guard<mutex> guard(Lock);
+	int event = Size.load();
+	pair<unordered_map<string, int>::iterator, bool> i = \
+		Events.insert(make_pair(lab, event));
+	
+	if (i.second) {
+		
+		int offset, block = locate(event, offset);
+		
+		if (offset == 0) {
+			
+			Blocks[block] = new string[(long) _EVENTTABLE_BLOCK << block];
+		}
+		
+		Blocks[block][offset] = lab;
+		Size.store(event + 1);
+	}
+	
+	return i.first->second;
+}
+
+/**
+ * \brief	Looks for a label.
+ * 
+ * \fn		int EventTable::find(const string &lab)
+ * \param	lab: the label.
+ * \return	The event of <i>lab</i>, or <code>_EVENTTABLE_NONE</code> if the
+ * 			label is not in the table.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int EventTable::find(const string &lab)
+{
+	lock_guard<mutex> guard(Lock);
+	unordered_map<string, int>::iterator i = Events.find(lab);
+	
+	if (i == Events.end()) {
+		
+		return _EVENTTABLE_NONE;
+	}
+	
+	return i->second;
+}
+
+/**
+ * \brief	Gets the label of an event.
+ * 
+ * \fn		const string & EventTable::getLabel(int event)
+ * \param	event: the event.
+ * \return	The label of <i>event</i>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const string & EventTable::getLabel(int event)
+{
+	assert(event >= 0 && event < Size.load());
+	
+	int offset, block = locate(event, offset);
+	
+	return Blocks[block][offset];
+}
+
+/**
+ * \brief	Gets the number of events.
+ * 
+ * \fn		int EventTable::size()
+ * \return	The number of different labels in the table.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int EventTable::size()
+{
+	return Size.load();
+}
+
+/**
+ * \brief	Finds where the label of an event is kept.
+ * 
+ * \fn		int EventTable::locate(int event, int &offset)
+ * \param	event: the event.
+ * \param	&offset: set to the position of the label in its block.
+ * \return	The block of the label.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int EventTable::locate(int event, int &offset)
+{
+	int block = 0;
+	long first = 0;
+	
+	// the first block is enough for most systems, so this is seldom looped
+	while (event - first >= ((long) _EVENTTABLE_BLOCK << block)) {
+		
+		first += (long) _EVENTTABLE_BLOCK << block;
+		block++;
+	}
+	
+	offset = event - first;
+	
+	return block;
+}
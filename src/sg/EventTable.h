@@ -0,0 +1,104 @@
+/**
+ * \file		sg/EventTable.h
+ * \brief		The definition of the <b>EventTable</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ * 
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#ifndef EVENTTABLE_H
+#define EVENTTABLE_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFINES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** Returned when a label is not in the table. */
+#define _EVENTTABLE_NONE				-10
+
+/** The number of labels in the first block of the table. */
+#define _EVENTTABLE_BLOCK				1024
+
+/** The number of blocks of the table. They double in size, so these are
+ *  enough for all the events an <code>int</code> can number. */
+#define _EVENTTABLE_BLOCKS				22
+
+/**
+ * \class	EventTable EventTable.h
+ * \brief	The <b>EventTable</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>EventTable</b> class. Interns the labels of the events: each
+ * different label is kept only once and is identified by a small integer,
+ * its event. Events are numbered from zero in the order the labels are
+ * inserted, and the reference returned by <code>getLabel()</code> remains
+ * valid while the table exists.
+ * 
+ * The table may be used by many threads. <code>insert()</code> and
+ * <code>find()</code> take a lock; <code>getLabel()</code>, which is called
+ * for each arc explored, does not: the labels are kept in blocks that never
+ * move, and a label is complete before its event is returned.
+ * 
+ * The table only grows: a label stays in it, with its event, until the table
+ * is destroyed. Each new block holds twice the labels of the last one, so
+ * there is no limit on the number of events but the range of an
+ * <code>int</code>.
+ */
+class EventTable {
+	
+	public:
+		
+		EventTable();
+		~EventTable();
+		
+		int insert(const string &lab);
+		int find(const string &lab);
+		const string & getLabel(int event);
+		int size();
+		
+	private:
+		
+		static int locate(int event, int &offset);
+
+		
+		/** The event of each label. */
+		unordered_map<string, int> Events;
+		
+		/** The label of each event. The block <i>b</i> keeps
+		 *  <code>_EVENTTABLE_BLOCK</code> * 2^<i>b</i> labels. */
+		string *Blocks[_EVENTTABLE_BLOCKS];
+		
+		/** The number of events. */
+		atomic<int> Size;
+		
+		/** Taken to insert or find a label. */
+		mutex Lock;
+};
+#endif /* EVENTTABLE_H */
@@ -0,0 +1,178 @@
+/**
+ * \file		sg/Pool.h
+ * \brief		The definition of the <b>Pool</b> class template.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ * 
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include <new>
+#include <vector>
+
+#ifndef POOL_H
+#define POOL_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFINES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** The number of objects in the first block of a pool. */
+#define _POOL_FIRST_BLOCK				16
+
+/** The largest number of objects in a block of a pool. */
+#define _POOL_LAST_BLOCK				4096
+
+/**
+ * \class	Pool Pool.h
+ * \brief	The <b>Pool</b> class template.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>Pool</b> class template. Keeps objects of type <i>T</i> in large
+ * blocks instead of one allocation each. The blocks double in size, from
+ * <code>_POOL_FIRST_BLOCK</code> to <code>_POOL_LAST_BLOCK</code> objects,
+ * so small processes stay small. The objects are built in the memory given
+ * by <code>allocate()</code>:
+ * 
+ * <code>State *s = new (pool.allocate()) State(lab, trg);</code>
+ * 
+ * and they never move. They are not freed one by one: all of them are
+ * destroyed, and the blocks freed, with the pool.
+ */
+template <class T> class Pool {
+	
+	public:
+		
+		Pool();
+		~Pool();
+		
+		void * allocate();
+		int size();
+		
+	private:
+		
+		/** The blocks of objects. */
+		vector<T *> Blocks;
+		
+		/** The number of objects in each block. */
+		vector<int> Capacity;
+		
+		/** The number of objects used in the last block. */
+		int Used;
+		
+		/** The number of objects in the pool. */
+		int Size;
+		
+		/** The pool owns its objects, so it can not be copied. */
+		Pool(const Pool &);
+		Pool & operator=(const Pool &);
+};
+
+/**
+ * \brief	Class constructor. Creates an empty pool.
+ * 
+ * \fn		Pool<T>::Pool()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+template <class T> Pool<T>::Pool()
+{
+	Used = 0;
+	Size = 0;
+}
+
+/**
+ * \brief	Class destructor. Destroys all the objects and frees the blocks.
+ * 
+ * \fn		Pool<T>::~Pool()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+template <class T> Pool<T>::~Pool()
+{
+	int cont, obj;
+	
+	for (cont = 0; cont < Blocks.size(); cont++) {
+		
+		int used = cont + 1 < Blocks.size() ? Capacity[cont] : Used;
+		
+		for (obj = 0; obj < used; obj++) {
+			
+			Blocks[cont][obj].~T();
+		}
+		
+		operator delete(Blocks[cont]);
+	}
+}
+
+/**
+ * \brief	Gets the memory of a new object.
+ * 
+ * \fn		void * Pool<T>::allocate()
+ * \return	The memory where the object must be built (with placement
+ * 			<code>new</code>) before the next call.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+template <class T> void * Pool<T>::allocate()
+{
+	if (Blocks.size() == 0 || Used == Capacity.back()) {
+		
+		int capacity = _POOL_FIRST_BLOCK;
+		
+		if (Blocks.size() > 0 && Capacity.back() < _POOL_LAST_BLOCK) {
+			
+			capacity = 2 * Capacity.back();
+		} else if (Blocks.size() > 0) {
+			
+			capacity = _POOL_LAST_BLOCK;
+		}
+		
+		Blocks.push_back((T *) operator new(capacity * sizeof(T)));
+		Capacity.push_back(capacity);
+		Used = 0;
+	}
+	
+	Size++;
+	
+	return &Blocks.back()[Used++];
+}
+
+/**
+ * \brief	Gets the number of objects in the pool.
+ * 
+ * \fn		int Pool<T>::size()
+ * \return	The number of calls to <code>allocate()</code>.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+template <class T> int Pool<T>::size()
+{
+	return Size;
+}
+#endif /* POOL_H */
@@ -48,8 +48,7 @@ Process::Process(const char *lab)
 	#endif
 	
 	label = lab;
-	target = nextTarget;
-	nextTarget++;
+	target = nextTarget++;
 	nextStateTarget = 0;
 	nextArcTarget = 0;
 	
@@ -72,8 +71,7 @@ Process::Process()
 		cerr << __FILE__ << ": " << __LINE__ << " Process()" << endl;
 	#endif
 	
-	target = nextTarget;
-	nextTarget++;
+	target = nextTarget++;
 	nextStateTarget = 0;
 	nextArcTarget = 0;
 	
@@ -83,7 +81,7 @@ Process::Process()
 }
 
 /**
- * \brief	Class destructor.
+ * \brief	Class destructor. The states and arcs are freed with their pools.
  * 
  * \fn		Process::~Process()
  * 
@@ -117,12 +115,13 @@ int Process::insertArc(int src, const char *lab, int dest)
 		cerr << __FILE__ << ": " << __LINE__ << endl;
 	#endif
 	
-	Arc *aux = new Arc(src, lab, dest, nextArcTarget);
+	Arc *aux = new (ArcPool.allocate()) Arc(src, lab, dest, nextArcTarget);
 	
 	if (aux != NULL) {
 		
 		Arcs.insert(Arcs.end(), aux);
 		// aux->~Arc(); // se destruir objeto vai ferrar a cópia no vetor
+		indexArc(aux);
 		nextArcTarget++;
 		return(Arcs.back()->getTarget());
 	}
@@ -159,13 +158,14 @@ int Process::insertArc(int src, const char *lab, int dest, int io, int ch)
 		cerr << __FILE__ << ": " << __LINE__ << " insertArc()" << endl;
 	#endif
 	
-	Arc *aux = new Arc(src, lab, dest, nextArcTarget);
+	Arc *aux = new (ArcPool.allocate()) Arc(src, lab, dest, nextArcTarget);
 	aux->setIO(io, ch);
 	
 	if (aux != NULL) {
 		
 		Arcs.insert(Arcs.end(), aux);
 		// aux->~Arc(); // se destruir objeto vai ferrar a cópia no vetor
+		indexArc(aux);
 		nextArcTarget++;
 		return(Arcs.back()->getTarget());
 	}
@@ -195,7 +195,7 @@ int Process::insertArc(const char *lab)
 		cerr << __FILE__ << ": " << __LINE__ << endl;
 	#endif
 	
-	Arc *aux = new Arc(lab, nextArcTarget);
+	Arc *aux = new (ArcPool.allocate()) Arc(lab, nextArcTarget);
 	
 	if (aux != NULL) {
 		
@@ -230,7 +230,7 @@ int Process::insertState(const char *lab)
 		cerr << __FILE__ << ": " << __LINE__ << endl;
 	#endif
 	
-	State *aux = new State(lab, nextStateTarget);
+	State *aux = new (StatePool.allocate()) State(lab, nextStateTarget);
 	
 	#ifdef _JABUTI_SG_DEBBUGING
 		cerr << __FILE__ << ": " << __LINE__ << endl;
@@ -251,6 +251,29 @@ int Process::insertState(const char *lab)
 	return _PROCESS_ERROR_CODE_NOT_INSERTED;
 }
 
+/**
+ * \brief	Inserts a new <b>State</b> element labelled by its target.
+ * 
+ * \fn		int Process::insertState()
+ * \return	The target associated with the new <b>State</b>. It is the
+ * 			number of states inserted before it.
+ * 
+ * No label is formatted: it is written from the target when it is needed
+ * (see <code>State::getLabel()</code>).
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int Process::insertState()
+{
+	State *aux = new (StatePool.allocate()) State(nextStateTarget);
+	
+	States.insert(States.end(), aux);
+	nextStateTarget++;
+	
+	return aux->getTarget();
+}
+
 /**
  * \brief	Checks if a state or an arc with a given label exists.
  * 
@@ -460,19 +483,19 @@ int Process::getTarget(int src, int dest)
 	
 	int cont;
 	int nStates = States.size();
-	int nArcs = Arcs.size();
 	
 	if (src < 0 || src >= nStates || dest < 0 || dest >= nStates) {
 		
 		return _PROCESS_ERROR_CODE_OUT_OF_RANGE;
 	}
 	
-	for (cont = 0; cont < nArcs; cont++) {
+	const vector<int> &out = getOutArcs(src);
+	
+	for (cont = 0; cont < out.size(); cont += 2) {
 		
-		if (Arcs[cont]->getSrc() == src
-		    && Arcs[cont]->getDest() == dest) {
+		if (out[cont + 1] == dest) {
 			
-			return Arcs[cont]->getTarget();
+			return out[cont];
 		}
 	}
 	
@@ -553,19 +576,19 @@ string Process::getLabel(int src, int dest)
 	
 	int cont;
 	int nStates = States.size();
-	int nArcs = Arcs.size();
 	
 	if (src < 0 || src >= nStates || dest < 0 || dest >= nStates) {
 		
 		return _PROCESS_ERROR_OUT_OF_RANGE;
 	}
 	
-	for (cont = 0; cont < nArcs; cont++) {
+	const vector<int> &out = getOutArcs(src);
+	
+	for (cont = 0; cont < out.size(); cont += 2) {
 		
-		if (Arcs[cont]->getSrc() == src
-		    && Arcs[cont]->getDest() == dest) {
+		if (out[cont + 1] == dest) {
 			
-			return Arcs[cont]->getLabel();
+			return Arcs[out[cont]]->getLabel();
 		}
 	}
 	
@@ -594,15 +617,12 @@ vector<int> Process::getSuccessors(int trg)
 	#endif
 	
 	int cont;
-	int nArcs = Arcs.size();
+	const vector<int> &out = getOutArcs(trg);
 	vector<int> succ;
 	
-	for (cont = 0; cont < nArcs; cont++) {
-	
-		if (Arcs[cont]->getSrc() == trg) {
+	for (cont = 0; cont < out.size(); cont += 2) {
 		
-			succ.insert(succ.end(), Arcs[cont]->getDest());
-		}	
+		succ.push_back(out[cont + 1]);
 	}
 	
 	#ifdef _JABUTI_SG_DEBBUGING
@@ -630,15 +650,12 @@ vector<int> Process::getPredecessors(int trg)
 	#endif
 	
 	int cont;
-	int nArcs = Arcs.size();
+	const vector<int> &in = getInArcs(trg);
 	vector<int> pred;
 	
-	for (cont = 0; cont < nArcs; cont++) {
-	
-		if (Arcs[cont]->getDest() == trg) {
+	for (cont = 0; cont < in.size(); cont += 2) {
 		
-			pred.insert(pred.end(), Arcs[cont]->getSrc());
-		}	
+		pred.push_back(in[cont + 1]);
 	}
 	
 	#ifdef _JABUTI_SG_DEBBUGING
@@ -647,3 +664,89 @@ vector<int> Process::getPredecessors(int trg)
 	
 	return pred;
 }
+
+/**
+ * \brief	Gets the arcs leaving a state.
+ * 
+ * \fn		const vector<int> & Process::getOutArcs(int trg)
+ * \param	trg: the target of the state.
+ * \return	The arcs leaving the state with target <i>trg</i>, as pairs
+ * 			(target of the arc, target of the destination state) in the order
+ * 			they were inserted. So the <i>i</i>-th arc is at positions
+ * 			2<i>i</i> and 2<i>i</i> + 1. The vector is empty if <i>trg</i> has
+ * 			no arcs or is out of range.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const vector<int> & Process::getOutArcs(int trg)
+{
+	if (trg < 0 || trg >= OutArcs.size()) {
+		
+		return NoArcs;
+	}
+	
+	return OutArcs[trg];
+}
+
+/**
+ * \brief	Gets the arcs entering a state.
+ * 
+ * \fn		const vector<int> & Process::getInArcs(int trg)
+ * \param	trg: the target of the state.
+ * \return	The arcs entering the state with target <i>trg</i>, as pairs
+ * 			(target of the arc, target of the source state) in the order they
+ * 			were inserted. The vector is empty if <i>trg</i> has no arcs or is
+ * 			out of range.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+const vector<int> & Process::getInArcs(int trg)
+{
+	if (trg < 0 || trg >= InArcs.size()) {
+		
+		return NoArcs;
+	}
+	
+	return InArcs[trg];
+}
+
+/**
+ * \brief	Adds a new arc to the lists of arcs of its source and destination
+ * 			states.
+ * 
+ * \fn		void Process::indexArc(Arc *a)
+ * \param	*a: the new arc.
+ * 
+ * The lists are indexed by the targets of the states, so they grow as needed:
+ * an arc may be inserted before its states.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+void Process::indexArc(Arc *a)
+{
+	int src = a->getSrc();
+	int dest = a->getDest();
+	
+	if (src < 0 || dest < 0) {
+		
+		return;
+	}
+	
+	if (src >= OutArcs.size()) {
+		
+		OutArcs.resize(src + 1);
+	}
+	
+	if (dest >= InArcs.size()) {
+		
+		InArcs.resize(dest + 1);
+	}
+	
+	OutArcs[src].push_back(a->getTarget());
+	OutArcs[src].push_back(dest);
+	InArcs[dest].push_back(a->getTarget());
+	InArcs[dest].push_back(src);
+}
@@ -28,8 +28,10 @@ using namespace std;
 #include "config.h"
 
 #include "Arc.h"
+#include "Pool.h"
 #include "State.h"
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -77,6 +79,9 @@ using namespace std;
  * 
  * The <b>Process</b> class. An object of this type represents a process of the
  * system.
+ * 
+ * The states and arcs are kept in pools owned by the process, and they are
+ * all freed with it. So a process can not be copied: pass a pointer.
  */
 class Process {
 	
@@ -96,6 +101,7 @@ class Process {
 		int insertArc(int src, const char *lab, int dest, int io, int ch);
 		int insertArc(const char *lab);				/* insert arc */
 		int insertState(const char *lab);			/* insert state */
+		int insertState();							/* insert numbered state */
 		
 		bool exists(const char *lab, int type);		/* exists state/arc? */
 		
@@ -109,6 +115,8 @@ class Process {
 		string getLabel(int src, int dest);			/* arc label */
 		vector<int> getSuccessors(int trg);			/* vector of successors */
 		vector<int> getPredecessors(int trg);		/* vector of predecessors */
+		const vector<int> & getOutArcs(int trg);	/* arcs leaving a state */
+		const vector<int> & getInArcs(int trg);		/* arcs entering a state */
 	
 	private:
 	
@@ -126,7 +134,30 @@ class Process {
 		 *  process. */
 		int nextArcTarget;
 		
-		/** The target of the next process to be created. */
-		static int nextTarget;
+		/** The arcs leaving each state, as pairs (target of the arc, target
+		 *  of the destination state), in the order they were inserted. */
+		vector<vector<int> > OutArcs;
+		
+		/** The arcs entering each state, as pairs (target of the arc, target
+		 *  of the source state), in the order they were inserted. */
+		vector<vector<int> > InArcs;
+		
+		/** Returned for the states without arcs. */
+		vector<int> NoArcs;
+		
+		/** The memory of the states. */
+		Pool<State> StatePool;
+		
+		/** The memory of the arcs. */
+		Pool<Arc> ArcPool;
+		
+		/** The target of the next process to be created. Atomic, as processes
+		 *  may be created by many threads. */
+		static atomic<int> nextTarget;
+		
+		void indexArc(Arc *a);						/* adds arc to the index */
+		
+		Process(const Process &);					/* not copied */
+		Process & operator=(const Process &);		/* not copied */
 };
 #endif /* PROCESS_H */
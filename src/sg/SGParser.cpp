@@ -32,19 +32,11 @@ using namespace std;
 
 #include <iostream>
 
+#include <fcntl.h>
 #include <stdlib.h>
-
-/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
- * EXTERNAL GLOBAL VARIABLES
- * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
- 
-/** External variable to set the current line number of the input file. */
-extern int lineNumber;
-
-/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
- * FUNCTIONS PROTOTYPES FROM LEX & YACC
- * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
-//extern int yyparse(void);
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 
 /**
@@ -58,6 +50,7 @@ extern int lineNumber;
 SGParser::SGParser()
 {
 	errors = false;
+	Scanner = NULL;
 }
 
 /**
@@ -72,9 +65,9 @@ SGParser::~SGParser()
 {}
 
 /**
- * \brief	Call yacc functions to parse input file.
+ * \brief	Parses a file.
  * 
- * \fn		int SGParser::callSGParser(char *f)
+ * \fn		int SGParser::callSGParser(const char *f)
  * \param	*f: name of the file containing the system description.
  * \return	An integer containing <b>_ERROR_NOT_EXISTS</b> if the input file
  * 			contains no parser errors. <b>_ERROR_EXISTS</b> if the file contains
@@ -82,27 +75,72 @@ SGParser::~SGParser()
  * 			open the input file. <b>_SGPARSER_ERROR_CODE_FILE_CL</b> if there
  * 			was an error when closing the input file.
  * 
+ * The file is mapped in memory and parsed with <code>parse()</code>.
+ * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	26/10/2004
  */
-int SGParser::callSGParser(char *f)
+int SGParser::callSGParser(const char *f)
 {
-	FILE *srcfile;
+	struct stat st;
+	void *buf = NULL;
+	int r, fd = open(f, O_RDONLY);
 	
-	if ((srcfile = fopen(f, "rb")) == NULL) {
+	if (fd == -1 || fstat(fd, &st) != 0) {
 		
 		return _SGPARSER_ERROR_CODE_FILE_OP;
 	}
 	
-	yyin = srcfile;
+	if (st.st_size > 0) {
+		
+		buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		
+		if (buf == MAP_FAILED) {
+			
+			close(fd);
+			return _SGPARSER_ERROR_CODE_FILE_OP;
+		}
+	}
+	
+	r = parse((const char *) buf, st.st_size);
 	
-	yyparse();
+	if (buf != NULL) {
+		
+		munmap(buf, st.st_size);
+	}
 	
-	if (fclose(srcfile) != 0) {
+	if (close(fd) != 0) {
 		
 		return _SGPARSER_ERROR_CODE_FILE_CL;
 	}
 	
+	return r;
+}
+
+/**
+ * \brief	Parses a system kept in memory.
+ * 
+ * \fn		int SGParser::parse(const char *buf, size_t len)
+ * \param	*buf: the system description. It does not need to end with a
+ * 			null character.
+ * \param	len: the size of the system description, in bytes.
+ * \return	<b>_ERROR_NOT_EXISTS</b> if the system contains no parser errors.
+ * 			<b>_ERROR_EXISTS</b> otherwise.
+ * 
+ * The channels and processes found are added to <code>Channels</code> and
+ * <code>Processes</code>. An object should parse only one system.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int SGParser::parse(const char *buf, size_t len)
+{
+	SGScanner scanner(this, buf, len);
+	
+	Scanner = &scanner;
+	yyparse(this, &scanner);
+	Scanner = NULL;
+	
 	if (hasErrors() == true) {
 		
 		return _SGPARSER_ERROR_EXISTS;
@@ -136,6 +174,7 @@ int SGParser::insertChannel(const char *s)
 		Channel *ch = new Channel(s);
 		Channels.insert(Channels.end(), ch);
 		trg = (Channels.size() - 1);
+		ChannelNames[s] = trg;
 	} else {
 		
 		pperrors(_SGPARSER_ERROR_ID_DECLARATION, s);
@@ -152,7 +191,11 @@ int SGParser::insertChannel(const char *s)
  * \brief	Sets the policy implemented by a channel.
  *
  * \fn		void SGParser::setType(int t)
- * \param	t: the type of the channel. May be <b>SIGNAL</b> or <b>MESSAGE</b>.
+ * \param	t: the type of the channel. May be <b>SIGNAL</b>, <b>MESSAGE</b>
+ * 			or <b>POOL</b>.
+ * 
+ * The number of slots of the channel is set too: one for a <b>MESSAGE</b>
+ * and two for the others, as the ACMs are synthesized.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	06/07/2004
@@ -168,16 +211,19 @@ void SGParser::setType(int t)
 		case SIGNAL:
 			
 			Channels.back()->setType(_CHANNEL_OWBB);
+			Channels.back()->setSlots(2);
 			break;
 		
 		case MESSAGE:
 			
 			Channels.back()->setType(_CHANNEL_RRBB);
+			Channels.back()->setSlots(1);
 			break;
 		
 		case POOL:
 		
 			Channels.back()->setType(_CHANNEL_OWRRBB);
+			Channels.back()->setSlots(2);
 			break;
 		
 		default:
@@ -215,6 +261,9 @@ int SGParser::insertProcess(const char *s)
 		Process *p = new Process(s);
 		Processes.insert(Processes.end(), p);
 		// p->~Process(); // fudeu tudo de novo
+		ProcessNames.insert(s);
+		StateNames.clear();
+		ArcNames.clear();
 	} else {
 				
 		pperrors(_SGPARSER_ERROR_ID_DECLARATION, s);
@@ -253,6 +302,8 @@ int SGParser::insertState(const char *id)
 	if (trg == _SGPARSER_N_DECLARED) {
 			
 		trg = Processes.back()->insertState(id);
+		StateNames[id] = trg;
+		LocalNames.insert(id);
 	} else if (trg == _SGPARSER_DECLARED_GLOBAL) {
 		
 		pperrors(_SGPARSER_ERROR_ID_DECLARATION, id);
@@ -300,7 +351,13 @@ int SGParser::insertArc()
 		
 		trg = Processes.back()->insertArc(tmp_src, \
 			(const char *)tmp_arc.c_str(), tmp_dest, tmp_iotype, tmp_ioch);
-	}else if (trg == _SGPARSER_DECLARED_GLOBAL) {
+	}
+	
+	if (trg >= 0) {
+		
+		ArcNames.insert(tmp_arc);
+		LocalNames.insert(tmp_arc);
+	} else if (trg == _SGPARSER_DECLARED_GLOBAL) {
 		
 		pperrors(_SGPARSER_ERROR_ID_DECLARATION, (const char *)tmp_arc.c_str());
 		pperrors(_SGPARSER_ERROR_ID_NOT_EXPECTED, (const char *)tmp_arc.c_str());
@@ -340,52 +397,9 @@ bool SGParser::exists(const char *id)
 		cerr << __FILE__ << ": " << __LINE__ << " exists()" << endl;
 	#endif
 	
-	int cont, cont2, size, size2;
 	string aux = id;
 	
-	size = Channels.size();
-	for (cont = 0; cont < size; cont++) {
-	
-		if (Channels[cont]->getLabel() == aux) {
-		
-			return true;
-		} 
-	}
-	
-	size = Processes.size();
-	for (cont = 0; cont < size; cont++) {
-	
-		if (Processes[cont]->getLabel() == aux) {
-		
-			return true;
-		}
-		
-		size2 = Processes[cont]->States.size();
-		
-		for (cont2 = 0; cont2 < size2; cont2++) {
-			
-			if (Processes[cont]->States[cont2]->getLabel() == aux) {
-				
-				return true;
-			}
-		}
-		
-		size2 = Processes[cont]->Arcs.size();
-		
-		for (cont2 = 0; cont2 < size2; cont2++) {
-			
-			if (Processes[cont]->Arcs[cont2]->getLabel() == aux) {
-				
-				return true;
-			}
-		}
-	}
-	
-	#ifdef _JABUTI_SG_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /exists()" << endl;
-	#endif
-	
-	return false;
+	return isGlobal(aux) || LocalNames.count(aux) > 0;
 }
 
 /**
@@ -405,22 +419,13 @@ int SGParser::existsChannel(const char *id)
 		cerr << __FILE__ << ": " << __LINE__ << " existsChannel()" << endl;
 	#endif
 	
-	int cont, size;
-	string aux = id;
-	
-	size = Channels.size();
-	for (cont = 0; cont < size; cont++) {
+	unordered_map<string, int>::iterator i = ChannelNames.find(id);
 	
-		if (Channels[cont]->getLabel() == aux) {
+	if (i != ChannelNames.end()) {
 		
-			return cont;
-		} 
+		return i->second;
 	}
 	
-	#ifdef _JABUTI_SG_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /existsChannel()" << endl;
-	#endif
-	
 	return _SGPARSER_N_DECLARED;
 }
 
@@ -446,49 +451,20 @@ int SGParser::existsState(const char *id)
 		cerr << __FILE__ << ": " << __LINE__ << " existsState()" << endl;
 	#endif
 	
-	int cont, size;
 	string aux = id;
+	unordered_map<string, int>::iterator i = StateNames.find(aux);
 	
-	size = Processes.back()->States.size();
-	for (cont = 0; cont < size; cont++) {
-		
-		if (Processes.back()->States[cont]->getLabel() == aux) {
-			
-			return cont;
-		}
-	}
-	
-	size = Processes.back()->Arcs.size();
-	for (cont = 0; cont < size; cont++) {
+	if (i != StateNames.end()) {
 		
-		if (Processes.back()->Arcs[cont]->getLabel() == aux) {
-	
-			return _SGPARSER_DECLARED_OTHER_TYPE;
-		}
-	}
-	
-	size = Channels.size();
-	for (cont = 0; cont < size; cont++) {
-	
-		if (Channels[cont]->getLabel() == aux) {
+		return i->second;
+	} else if (ArcNames.count(aux) > 0) {
 		
-			return _SGPARSER_DECLARED_GLOBAL;
-		} 
-	}
-	
-	size = Processes.size();
-	for (cont = 0; cont < size; cont++) {
-	
-		if (Processes[cont]->getLabel() == aux) {
+		return _SGPARSER_DECLARED_OTHER_TYPE;
+	} else if (isGlobal(aux)) {
 		
-			return _SGPARSER_DECLARED_GLOBAL;
-		} 
+		return _SGPARSER_DECLARED_GLOBAL;
 	}
 	
-	#ifdef _JABUTI_SG_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /existsState()" << endl;
-	#endif
-	
 	return _SGPARSER_N_DECLARED;
 }
 
@@ -517,52 +493,19 @@ int SGParser::existsArc(int src, const char *id, int dest)
 		cerr << __FILE__ << ": " << __LINE__ << " existsArc()" << endl;
 	#endif
 	
-	int cont, size;
 	string aux = id;
-
-	size = Processes.back()->Arcs.size();
-	for (cont = 0; cont < size; cont++) {
-		
-		if (Processes.back()->Arcs[cont]->getSrc() == src
-			&& Processes.back()->Arcs[cont]->getDest() == dest) {
 	
-			return _SGPARSER_REDECLARED;
-		}
-	}	
-	
-	size = Processes.back()->States.size();
-	for (cont = 0; cont < size; cont++) {
+	if (Processes.back()->getTarget(src, dest) >= 0) {
 		
-		if (Processes.back()->States[cont]->getLabel() == aux) {
-			
-			return _SGPARSER_DECLARED_OTHER_TYPE;
-		}
-	}
-	
-
-	
-	size = Channels.size();
-	for (cont = 0; cont < size; cont++) {
-	
-		if (Channels[cont]->getLabel() == aux) {
+		return _SGPARSER_REDECLARED;
+	} else if (StateNames.count(aux) > 0) {
 		
-			return _SGPARSER_DECLARED_GLOBAL;
-		} 
-	}
-	
-	size = Processes.size();
-	for (cont = 0; cont < size; cont++) {
-	
-		if (Processes[cont]->getLabel() == aux) {
+		return _SGPARSER_DECLARED_OTHER_TYPE;
+	} else if (isGlobal(aux)) {
 		
-			return _SGPARSER_DECLARED_GLOBAL;
-		} 
+		return _SGPARSER_DECLARED_GLOBAL;
 	}
 	
-	#ifdef _JABUTI_SG_DEBBUGING
-		cerr << __FILE__ << ": " << __LINE__ << " /existsArc()" << endl;
-	#endif
-	
 	return _SGPARSER_N_DECLARED;
 }
 
@@ -750,6 +693,9 @@ bool SGParser::setArc(const char *ch, int type)
  * \return	<code><b>true</b></code> if the writter was properly setted.
  * 			<code><b>false</b></code> otherwise.
  * 
+ * The process is identified by its position in <code>Processes</code>, so
+ * the result does not depend on the other systems parsed.
+ * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	11/06/2004
  */
@@ -769,12 +715,12 @@ bool SGParser::setWriter(const char *ch)
 	}
 	
 	if (Channels[trg]->getWriter() != _CHANNEL_NONE
-		&& Channels[trg]->getWriter() != Processes.back()->getTarget()) {
+		&& Channels[trg]->getWriter() != Processes.size() - 1) {
 		
 		return false;
 	}
 
-	Channels[trg]->setWriter(Processes.back()->getTarget());
+	Channels[trg]->setWriter(Processes.size() - 1);
 	
 	#ifdef _JABUTI_SG_DEBBUGING
 		cerr << __FILE__ << ": " << __LINE__ << " /setWriter()" << endl;
@@ -791,6 +737,9 @@ bool SGParser::setWriter(const char *ch)
  * \return	<code><b>true</b></code> if the reader was properly setted.
  * 			<code><b>false</b></code> otherwise.
  * 
+ * The process is identified by its position in <code>Processes</code>, so
+ * the result does not depend on the other systems parsed.
+ * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	06/07/2004
  */
@@ -810,12 +759,12 @@ bool SGParser::setReader(const char *ch)
 	}
 	
 	if (Channels[trg]->getReader() != _CHANNEL_NONE
-		&& Channels[trg]->getReader() != Processes.back()->getTarget()) {
+		&& Channels[trg]->getReader() != Processes.size() - 1) {
 		
 		return false;
 	}
 
-	Channels[trg]->setReader(Processes.back()->getTarget());
+	Channels[trg]->setReader(Processes.size() - 1);
 	
 	#ifdef _JABUTI_SG_DEBBUGING
 		cerr << __FILE__ << ": " << __LINE__ << " /setReader()" << endl;
@@ -835,7 +784,7 @@ bool SGParser::setReader(const char *ch)
  */
 void SGParser::pperrors(const char *m)
 {
-	cerr << "line " << lineNumber << ": " << m << endl;
+	cerr << "line " << (Scanner ? Scanner->getLine() : 0) << ": " << m << endl;
 	errors = true;
 }
 
@@ -851,7 +800,8 @@ void SGParser::pperrors(const char *m)
  */
 void SGParser::pperrors(const char *m, const char *f)
 {
-	cerr << "line " << lineNumber << ": " << f << " - " << m << endl;
+	cerr << "line " << (Scanner ? Scanner->getLine() : 0) << ": " << f \
+		 << " - " << m << endl;
 	errors = true;
 }
 
@@ -884,3 +834,19 @@ bool SGParser::hasErrors()
 {
 	return errors;
 }
+
+/**
+ * \brief	Checks if an ID is the label of a channel or of a process.
+ *
+ * \fn		bool SGParser::isGlobal(const string &id)
+ * \param	id: the identifier.
+ * \return	<code><b>true</b></code> if <i>id</i> was declared as a global
+ * 			name. <code><b>false</b></code> otherwise.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+bool SGParser::isGlobal(const string &id)
+{
+	return ChannelNames.count(id) > 0 || ProcessNames.count(id) > 0;
+}
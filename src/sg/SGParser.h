@@ -32,8 +32,11 @@ using namespace std;
 
 #include "Channel.h"
 #include "Process.h"
+#include "SGScanner.h"
 
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <stdio.h>
@@ -140,13 +143,6 @@ using namespace std;
 /** Error code: policy for less than two cells not implemented. */
 #define _SGPARSER_ERROR_CODE_FEW_CELLS		-180
 
-/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
- * GLOBAL VARIABLES
- * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
-
-/** Used to set the input file name for LeX & Yacc. */
-extern FILE *yyin;
-
 /**
  * \class	SGParser SGParser.h
  * \brief	The <b>SGParser</b> class.
@@ -156,10 +152,15 @@ extern FILE *yyin;
  * The <b>SGParser</b> class. An object of this type implements a parser for the
  * files containing the description of the system.
  * 
- * It is very important to oberve that any application that will use the parser
- * defined here <b>SHOULD</b> declare an object of type <b>SGParser</b> named
- * <b>sgparser</b> as a global variable. If <b>sgparser</b> was not declared the
- * parser will not works correctly.
+ * Each object parses one system, from a file (<code>callSGParser()</code>)
+ * or from a buffer (<code>parse()</code>), and keeps its channels and
+ * processes. The parser has no global state, so many systems may be parsed
+ * at the same time by different threads, each one with its own object.
+ * 
+ * The identifiers are resolved in hashed tables: one for the global names
+ * (channels and processes), one for the names of the states and arcs of all
+ * processes, and two for the states and arcs of the process being parsed.
+ * So each identifier is checked in constant time.
  */
 class SGParser {
 
@@ -175,7 +176,8 @@ class SGParser {
 		SGParser();								/* class constructor */
 		~SGParser();							/* class destructor */
 		
-		int callSGParser(char *f);
+		int callSGParser(const char *f);
+		int parse(const char *buf, size_t len);
 		
 		/* Public methods */
 		int insertChannel(const char *s);		/* insert channel */
@@ -208,6 +210,10 @@ class SGParser {
 		/** To indicate if errors occured when parsing. */
 		bool errors;
 		
+		/** The scanner of the system being parsed, for the line numbers of
+		 *  the errors. <code>NULL</code> out of <code>parse()</code>. */
+		SGScanner *Scanner;
+		
 		/* Para armazenar informações temporariamente (isso é culpa do yacc) */
 		int tmp_src;		/**< source state target. (for bison) */
 		int tmp_dest;		/**< destination state target. (for bison) */
@@ -215,5 +221,22 @@ class SGParser {
 		bool tmp_ioarc;		/**< IO arc? (for bison) */
 		int tmp_iotype;		/**< IO is READ os WRITE. (for bison) */
 		int tmp_ioch;		/**< IO channel. (for bison) */
+		
+		/** The target of each channel, by label. */
+		unordered_map<string, int> ChannelNames;
+		
+		/** The labels of the processes. */
+		unordered_set<string> ProcessNames;
+		
+		/** The labels of the states and arcs of all processes. */
+		unordered_set<string> LocalNames;
+		
+		/** The target of each state of the current process, by label. */
+		unordered_map<string, int> StateNames;
+		
+		/** The labels of the arcs of the current process. */
+		unordered_set<string> ArcNames;
+		
+		bool isGlobal(const string &id);
 };
 #endif /* SGPARSER_H */
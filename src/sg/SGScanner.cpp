@@ -0,0 +1,204 @@
+/**
+ * \file		sg/SGScanner.cpp
+ * \brief		The methods of the <b>SGScanner</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ * 
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "SGScanner.h"
+#include "SGParser.h"
+#include "sg_yacc.h"
+
+#include <string>
+
+#include <ctype.h>
+#include <string.h>
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * CLASS CONSTRUCTORS / DESTRUCTOR
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Class constructor. Creates a new <b>SGScanner</b> element.
+ * 
+ * \fn		SGScanner::SGScanner(SGParser *p, const char *buf, size_t len)
+ * \param	*p: the parser that receives the errors.
+ * \param	*buf: the system. It is not copied, so it must live as long as
+ * 			the scanner.
+ * \param	len: the size of the system, in bytes.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+SGScanner::SGScanner(SGParser *p, const char *buf, size_t len)
+{
+	Parser = p;
+	Cursor = buf;
+	End = buf + len;
+	Line = 1;
+}
+
+/**
+ * \brief	Class destructor.
+ * 
+ * \fn		SGScanner::~SGScanner()
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+SGScanner::~SGScanner()
+{}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PUBLIC METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Reads the next token.
+ * 
+ * \fn		int SGScanner::lex(YYSTYPE *lval)
+ * \param	*lval: where the value of an <code>ID</code> or a
+ * 			<code>NUMBER</code> is written.
+ * \return	The token, or zero at the end of the buffer.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int SGScanner::lex(YYSTYPE *lval)
+{
+	while (Cursor < End) {
+		
+		const char *start = Cursor;
+		unsigned char c = *Cursor++;
+		
+		if (c == '\n') {
+			
+			Line++;
+		} else if (c == ' ' || c == '\t' || c == '\r') {
+			
+			// in this case do nothing
+		} else if (c == '#') {
+			
+			while (Cursor < End && *Cursor != '\n') {
+				
+				Cursor++;
+			}
+		} else if (c == ';' || c == '(' || c == ')') {
+			
+			return c;
+		} else if (isdigit(c)) {
+			
+			lval->iValue = c - '0';
+			
+			while (Cursor < End && isdigit((unsigned char) *Cursor)) {
+				
+				lval->iValue = lval->iValue * 10 + (*Cursor++ - '0');
+			}
+			
+			return NUMBER;
+		} else if (isalpha(c) || c == '_') {
+			
+			while (Cursor < End && (isalnum((unsigned char) *Cursor) \
+										|| *Cursor == '_')) {
+				
+				Cursor++;
+			}
+			
+			size_t len = Cursor - start;
+			int token = keyword(start, len);
+			
+			if (token != ID) {
+				
+				return token;
+			} else if (len <= _SGSCANNER_MAX_ID_SIZE) {
+				
+				memcpy(lval->sValue, start, len);
+				lval->sValue[len] = '\0';
+			} else {
+				
+				string id(start, len);
+				
+				Parser->pperrors(_SGPARSER_ERROR_ID_SIZE, id.c_str());
+				lval->sValue[0] = '\0';
+			}
+			
+			return ID;
+		} else {
+			
+			return YYUNDEF;
+		}
+	}
+	
+	return 0;
+}
+
+/**
+ * \brief	Gets the number of the current line.
+ * 
+ * \fn		int SGScanner::getLine()
+ * \return	The line of the last token read, starting at one.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int SGScanner::getLine()
+{
+	return Line;
+}
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * PRIVATE METHODS
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/**
+ * \brief	Looks for a keyword.
+ * 
+ * \fn		int SGScanner::keyword(const char *id, size_t len)
+ * \param	*id: the identifier. It does not end with a null character.
+ * \param	len: the size of the identifier.
+ * \return	The token of the keyword, or <code>ID</code> if <i>id</i> is not
+ * 			a keyword.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+int SGScanner::keyword(const char *id, size_t len)
+{
+	static const char *lower[] = {"channel", "end", "process", "read", \
+								  "write", "signal", "message", "pool"};
+	static const char *upper[] = {"CHANNEL", "END", "PROCESS", "READ", \
+								  "WRITE", "SIGNAL", "MESSAGE", "POOL"};
+	static const int tokens[] = {CHANNEL, END, PROCESS, READ, \
+								 WRITE, SIGNAL, MESSAGE, POOL};
+	
+	for (int cont = 0; cont < sizeof(tokens) / sizeof(int); cont++) {
+		
+		if (strlen(lower[cont]) == len && (memcmp(id, lower[cont], len) == 0 \
+									|| memcmp(id, upper[cont], len) == 0)) {
+			
+			return tokens[cont];
+		}
+	}
+	
+	return ID;
+}
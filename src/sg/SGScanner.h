@@ -0,0 +1,100 @@
+/**
+ * \file		sg/SGScanner.h
+ * \brief		The definition of the <b>SGScanner</b> class.
+ * \author		agent (agent@local)
+ * \date		October, 2026
+ * \version		$Id$
+ * 
+ * Copyright (C) 2004, 2008 - Kyller Costa Gorgônio
+ * Copyright (C) 2004, 2008 - Universitat Politècnica de Catalunya
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+using namespace std;
+
+#include "config.h"
+
+#include <stddef.h>
+
+#ifndef SGSCANNER_H
+#define SGSCANNER_H
+
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+ * DEFINES
+ * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+
+/** The largest size of an identifier. */
+#define _SGSCANNER_MAX_ID_SIZE			256
+
+class SGParser;
+union YYSTYPE;
+
+/**
+ * \class	SGScanner SGScanner.h
+ * \brief	The <b>SGScanner</b> class.
+ * \author	agent (agent@local)
+ * \date	October, 2026
+ * 
+ * The <b>SGScanner</b> class. Splits a <code>.sg</code> system, kept in a
+ * buffer, in the tokens read by the parser (see <code>sg_yacc.ypp</code>).
+ * All its state is in the object, so many systems may be scanned at the
+ * same time, each one with its own scanner.
+ * 
+ * It replaces the <b>LeX</b> scanner (<code>sg_lex.lpp</code>), whose
+ * state was global. The tokens are the same: the keywords (all in lower or
+ * all in upper case), the identifiers, the numbers and the characters
+ * <code>;</code>, <code>(</code> and <code>)</code>. Blanks and comments,
+ * from <code>#</code> to the end of the line, are skipped. The diagnostics
+ * differ in that:
+ * 	-	any other character is returned as an undefined token, so the
+ * 		parser reports a syntax error in its line. The <b>LeX</b> scanner
+ * 		echoed it to the standard output, mixed with the <code>ACM</code>,
+ * 		and went on (see <code>docs/examples/malformed.sg</code>);
+ * 	-	carriage returns are blanks, and a comment in the last line needs
+ * 		no new line after it. The <b>LeX</b> scanner echoed the carriage
+ * 		returns, and the <code>#</code> of such a comment, whose words it
+ * 		then read as tokens;
+ * 	-	an identifier longer than <code>_SGSCANNER_MAX_ID_SIZE</code> is
+ * 		still reported, and then read as an empty identifier instead of
+ * 		the previous one.
+ */
+class SGScanner {
+	
+	public:
+		
+		SGScanner(SGParser *p, const char *buf, size_t len);
+		~SGScanner();
+		
+		int lex(YYSTYPE *lval);
+		int getLine();
+		
+	private:
+		
+		/** The parser that receives the errors. */
+		SGParser *Parser;
+		
+		/** The next character to be read. */
+		const char *Cursor;
+		
+		/** The end of the buffer. */
+		const char *End;
+		
+		/** The number of the current line. */
+		int Line;
+		
+		int keyword(const char *id, size_t len);
+};
+#endif /* SGSCANNER_H */
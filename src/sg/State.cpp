@@ -30,6 +30,8 @@ using namespace std;
 
 #include <iostream>
 
+#include <stdio.h>
+
 /**
  * \brief	Class constructor. Creates a new <b>State</b> element.
  * 
@@ -48,12 +50,29 @@ State::State(const char *lab, int trg)
 	
 	label = lab;
 	target = trg;
+	named = true;
 	
 	#ifdef _JABUTI_SG_DEBBUGING
 		cerr << __FILE__ << ": " << __LINE__ << " /State()" << endl;
 	#endif
 }
 
+/**
+ * \brief	Class constructor. Creates a new <b>State</b> element labelled by
+ * 			its target.
+ * 
+ * \fn		State::State(int trg)
+ * \param	trg: the target of the state.
+ * 
+ * \author	agent (agent@local)
+ * \date	17/10/2026
+ */
+State::State(int trg)
+{
+	target = trg;
+	named = false;
+}
+
 /**
  * \brief	Class destructor.
  * 
@@ -73,7 +92,8 @@ State::~State()
  * \brief	Gets the label of the state.
  * 
  * \fn		string State::getLabel()
- * \return	A string with the label of the state.
+ * \return	A string with the label of the state, or with its target if it
+ * 			has no label.
  * 
  * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
  * \date	31/05/2004
@@ -84,6 +104,14 @@ string State::getLabel()
 		cerr << __FILE__ << ": " << __LINE__ << " getLabel()" << endl;
 	#endif
 	
+	if (named == false) {
+		
+		char saux[16];
+		
+		snprintf(saux, sizeof(saux), "%d", target);
+		return saux;
+	}
+	
 	return(label);
 }
 
@@ -122,6 +150,7 @@ void State::setLabel(const char *lab)
 	
 	string aux = lab;
 	label.swap(aux);
+	named = true;
 	
 	#ifdef _JABUTI_SG_DEBBUGING
 		cerr << __FILE__ << ": " << __LINE__ << " /setLabel()" << endl;
@@ -40,12 +40,18 @@ using namespace std;
  * 
  * The <b>State</b> class. An object of this type represents a state of a
  * process
+ * 
+ * A state may have no label of its own (see <code>State(int)</code>): then
+ * its label is its target, written only when <code>getLabel()</code> is
+ * called. The states of the synthesized <code>ACM</code> are like that, so
+ * they are created without formatting any string.
  */
 class State {
 
 	public:
 	
 		State(const char *lab, int trg);
+		State(int trg);
 		~State();
 		
 		string getLabel();
@@ -60,5 +66,9 @@ class State {
 		
 		/** The target of the state. */
 		int target;
+		
+		/** If the state has a label of its own. Otherwise its label is its
+		 *  target. */
+		bool named;
 };
 #endif /* STATE_H */
@@ -26,47 +26,6 @@
 #ifndef SG_H
 #define SG_H
 
-#ifndef DOXYGEN_SHOULD_SKIP_THIS
-
-/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
- * INTERNAL FUNCTIONS PROTOTYPES
- * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
-
-/**
- * \brief	Prints an error message.
- *
- * \fn		void yyerror(char *mesg)
- * \param	*mesg: the error message.
- * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	25/05/2004
- */
-void yyerror(char *mesg);
-
-/**
- * \brief	Prints an error message.
- *
- * \fn		void yyerror2(char *mesg, char *v)
- * \param	*mesg: the error message.
- * \param	*v: the identifier related to the error.
- * 
- * \author	Kyller Costa Gorgônio (kyller@lsi.upc.edu)
- * \date	25/05/2004
- */
-void yyerror2(char *mesg, char *v);
-
-#endif /* DOXYGEN_SHOULD_SKIP_THIS */
-
-/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
- * FUNCTIONS PROTOTYPES FROM LEX & YACC
- * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
-
-/** for calling LEX. */
-extern int yylex();
-
-/** For calling YACC (BISON). */
-extern int yyparse(void);
-
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * ERRORS MESSAGE
  * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
@@ -42,8 +42,8 @@ using namespace std;
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * INITIALIZING CLASS VARIABLES
  * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
-int Process::nextTarget = 0;
-int Channel::nextTarget = 0;
+atomic<int> Process::nextTarget(0);
+atomic<int> Channel::nextTarget(0);
 
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * LOCAL FUNCTIONS PROTOTYPES
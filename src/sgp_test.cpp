@@ -35,15 +35,8 @@ using namespace std;
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * INITIALIZING CLASS VARIABLES
  * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
-int Process::nextTarget = 0;
-int Channel::nextTarget = 0;
-
-/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
- * GLOBAL VARIABLES
- * +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */ 
-
-/** To be used inside <i>yyparser()</i>. It SHOULD exists. */
-SGParser sgparser;
+atomic<int> Process::nextTarget(0);
+atomic<int> Channel::nextTarget(0);
 
 /* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
  * FUNCTIONS PROTOTYPES
@@ -148,6 +141,7 @@ static void printSystem(SGParser pp)
 int main(int argc, char *argv[])
 {
 	int r = _SGPARSER_ERROR_NOT_EXISTS;
+	SGParser sgparser;
 	
 	if (argc != 2) {
 		